@@ -1,5 +1,6 @@
 #include "application/Application.h"
 
+#include <charconv>
 #include <stdexcept>
 #include <iostream>
 #include <format>
@@ -34,7 +35,10 @@ namespace {
         ApplicationAttributes GetAttributes() const {
             ApplicationAttributes attributes = {
                 .taskType = TaskType::None,
-                .useSemantic = false
+                .useSemantic = false,
+                .lexerOptions = {},
+                .parserOptions = {},
+                .quiet = false
             };
 
             m_current = 1;
@@ -44,6 +48,10 @@ namespace {
                     if (attributes.taskType != TaskType::None)
                         throw ArgumentException("Ya se ha indicado un tipo de tarea a realizar.");
                     attributes.taskType = TaskType::Tokens;
+                } else if (m_arg == "-b") {
+                    if (attributes.taskType != TaskType::None)
+                        throw ArgumentException("Ya se ha indicado un tipo de tarea a realizar.");
+                    attributes.taskType = TaskType::BinaryTokens;
                 } else if (m_arg == "-s") {
                     if (attributes.taskType != TaskType::None)
                         throw ArgumentException("Ya se ha indicado un tipo de tarea a realizar.");
@@ -54,6 +62,26 @@ namespace {
                     attributes.taskType = TaskType::Parse;
                 } else if (m_arg == "-u") {
                     attributes.useSemantic = true;
+                } else if (m_arg == "-q") {
+                    attributes.quiet = true;
+                } else if (m_arg == "--ascii") {
+                    attributes.lexerOptions.asciiOnly = true;
+                } else if (m_arg == "--pretokenize") {
+                    attributes.lexerOptions.pretokenize = true;
+                } else if (m_arg == "--lexer-threads") {
+                    if (!GetNextArgument())
+                        throw ArgumentException("Después de «--lexer-threads» se debe especificar un número de hilos.");
+
+                    unsigned threads = 0;
+                    const auto [end, error] = std::from_chars(m_arg.data(), m_arg.data() + m_arg.size(), threads);
+                    if (error != std::errc() || end != m_arg.data() + m_arg.size() || threads == 0)
+                        throw ArgumentException(std::format("El número de hilos «{}» no es válido.", m_arg));
+
+                    // Sólo se analiza en paralelo la entrada completa.
+                    attributes.lexerOptions.pretokenize = true;
+                    attributes.lexerOptions.threads = threads;
+                } else if (m_arg == "--table-parser") {
+                    attributes.parserOptions.tableDriven = true;
                 } else if (m_arg == "-i") {
                     if (!attributes.inputFileName.empty())
                         throw ArgumentException("Ya se ha definido un fichero de entrada.");
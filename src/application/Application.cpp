@@ -1,11 +1,12 @@
 #include "Application.h"
 
+#include "application/TokenWriter.h"
+#include "language/stream/TokenStreamWriter.h"
 #include "language/process/Lexer.h"
 #include "language/process/Parser.h"
 
 #include <iostream>
 #include <fstream>
-#include <sstream>
 
 namespace {
     void LogCriticalError(const CriticalLanguageException& e) {
@@ -13,92 +14,161 @@ namespace {
     }
 
 
-    int GenerateTokens(std::istream& input, std::ostream& output) {
+    int GenerateTokens(Source& input, std::ostream& output, const LexerOptions& lexerOptions, bool quiet) {
         Lexer lexer(input);
         GlobalState globals = {
+            .errorManager = ErrorManager(quiet),
             .useSemantic = false,
+            .lexerOptions = lexerOptions,
             .globalTable = { SymbolTable(0) }
         };
 
+        TokenWriter writer(output, globals.literals);
+
         try {
             bool isRunning = true;
             while (isRunning) {
                 const auto token = lexer.GetToken(globals);
-                std::string content = TokenAttributeToString(token);
-                output << "<" << ToString(token.type) << ", " << content << ">" << std::endl;
+                writer.Write(token);
                 if (token.type == TokenType::END) isRunning = false;
+
+                // Una vez escrito el token, no se vuelve a consultar su cadena.
+                // Si se ha analizado la entrada por adelantado, aún quedan por escribir otras.
+                if (!globals.lexerOptions.pretokenize)
+                    globals.literals.Clear();
             }
         } catch (const CriticalLanguageException& e) {
-            LogCriticalError(e);
+            if (!quiet)
+                LogCriticalError(e);
         }
 
         return globals.errorManager.GetStatus();
     }
 
-    int GenerateTokens(std::istream& input, const std::string& outputFileName) {
+    int GenerateTokens(Source& input, const std::string& outputFileName, const LexerOptions& lexerOptions, bool quiet) {
         std::ofstream tokenFile(outputFileName.empty() ? "tokens.txt" : outputFileName, std::ios::binary);
-        return GenerateTokens(input, tokenFile);
+        return GenerateTokens(input, tokenFile, lexerOptions, quiet);
+    }
+
+    int GenerateTokens(const std::string& inputFileName, const std::string& outputFileName, const LexerOptions& lexerOptions, bool quiet) {
+        auto source = Source::OpenFile(inputFileName);
+        if (!source.has_value()) {
+            std::cerr << "No existe el archivo \"" << inputFileName << "\"." << std::endl;
+            return 1;
+        }
+
+        return GenerateTokens(*source, outputFileName, lexerOptions, quiet);
+    }
+
+
+    int GenerateBinaryTokens(Source& input, std::ostream& output, const LexerOptions& lexerOptions, bool quiet) {
+        Lexer lexer(input);
+        GlobalState globals = {
+            .errorManager = ErrorManager(quiet),
+            .useSemantic = false,
+            .lexerOptions = lexerOptions,
+            .globalTable = { SymbolTable(0) }
+        };
+
+        TokenStreamWriter writer(output, globals.literals);
+
+        try {
+            try {
+                bool isRunning = true;
+                while (isRunning) {
+                    const auto token = lexer.GetToken(globals);
+                    writer.Write(token);
+                    if (token.type == TokenType::END) isRunning = false;
+
+                    // El escritor ya ha copiado la cadena del token.
+                    // Si se ha analizado la entrada por adelantado, aún quedan por escribir otras.
+                    if (!globals.lexerOptions.pretokenize)
+                        globals.literals.Clear();
+                }
+            } catch (const CriticalLanguageException& e) {
+                if (!quiet)
+                    LogCriticalError(e);
+            }
+
+            writer.Finish(*globals.globalTable);
+        } catch (const TokenStreamTooLargeException& e) {
+            // El flujo queda sin terminar, y los lectores lo rechazan.
+            globals.errorManager.LogError(e.what());
+        }
+
+        return globals.errorManager.GetStatus();
     }
 
-    int GenerateTokens(const std::string& inputFileName, const std::string& outputFileName) {
-        std::ifstream fileStream(inputFileName, std::ios::binary);
-        if (!fileStream) {
+    int GenerateBinaryTokens(Source& input, const std::string& outputFileName, const LexerOptions& lexerOptions, bool quiet) {
+        std::ofstream tokenFile(outputFileName.empty() ? "tokens.bin" : outputFileName, std::ios::binary);
+        return GenerateBinaryTokens(input, tokenFile, lexerOptions, quiet);
+    }
+
+    int GenerateBinaryTokens(const std::string& inputFileName, const std::string& outputFileName, const LexerOptions& lexerOptions, bool quiet) {
+        auto source = Source::OpenFile(inputFileName);
+        if (!source.has_value()) {
             std::cerr << "No existe el archivo \"" << inputFileName << "\"." << std::endl;
             return 1;
         }
 
-        return GenerateTokens(fileStream, outputFileName);
+        return GenerateBinaryTokens(*source, outputFileName, lexerOptions, quiet);
     }
 
 
-    int GenerateParse(std::istream& input, std::ostream& output, bool useSemantic) {
+    int GenerateParse(Source& input, std::ostream& output, bool useSemantic, const LexerOptions& lexerOptions, const ParserOptions& parserOptions, bool quiet) {
         Parser parser(input);
         GlobalState globals = {
+            .errorManager = ErrorManager(quiet),
             .syntaxPrint = SyntaxPrint::PARSE,
-            .useSemantic = useSemantic
+            .useSemantic = useSemantic,
+            .lexerOptions = lexerOptions,
+            .parserOptions = parserOptions
         };
 
-        std::ostringstream ss;
-
         try {
-            parser.Parse(ss, globals);
+            parser.Parse(globals);
         } catch (const CriticalLanguageException& e) {
-            LogCriticalError(e);
+            if (!quiet)
+                LogCriticalError(e);
         }
 
-        output << "Des" << ss.str() << std::endl;
+        output << "Des";
+        globals.parseTrace.Write(output);
+        output << std::endl;
         return globals.errorManager.GetStatus();
     }
 
-    int GenerateParse(std::istream& input, const std::string& outputFileName, bool useSemantic) {
+    int GenerateParse(Source& input, const std::string& outputFileName, bool useSemantic, const LexerOptions& lexerOptions, const ParserOptions& parserOptions, bool quiet) {
         int result = 0;
 
         if (outputFileName.empty()) {
-            result = GenerateParse(input, std::cout, useSemantic);
+            result = GenerateParse(input, std::cout, useSemantic, lexerOptions, parserOptions, quiet);
         } else {
             std::ofstream symbolsFile(outputFileName, std::ios::binary);
-            result = GenerateParse(input, symbolsFile, useSemantic);
+            result = GenerateParse(input, symbolsFile, useSemantic, lexerOptions, parserOptions, quiet);
         }
 
         return result;
     }
 
-    int GenerateParse(const std::string& inputFileName, const std::string& outputFileName, bool useSemantic) {
-        std::ifstream fileStream(inputFileName, std::ios::binary);
-        if (!fileStream) {
+    int GenerateParse(const std::string& inputFileName, const std::string& outputFileName, bool useSemantic, const LexerOptions& lexerOptions, const ParserOptions& parserOptions, bool quiet) {
+        auto source = Source::OpenFile(inputFileName);
+        if (!source.has_value()) {
             std::cerr << "No existe el archivo \"" << inputFileName << "\"." << std::endl;
             return 1;
         }
 
-        return GenerateParse(fileStream, outputFileName, useSemantic);
+        return GenerateParse(*source, outputFileName, useSemantic, lexerOptions, parserOptions, quiet);
     }
 
 
-    int GenerateLexicalSymbols(std::istream& input, std::ostream& output) {
+    int GenerateLexicalSymbols(Source& input, std::ostream& output, const LexerOptions& lexerOptions, bool quiet) {
         Lexer lexer(input);
         GlobalState globals = {
+            .errorManager = ErrorManager(quiet),
             .syntaxPrint = SyntaxPrint::SYMBOLS,
             .useSemantic = false,
+            .lexerOptions = lexerOptions,
             .globalTable = { SymbolTable(0) }
         };
 
@@ -109,7 +179,8 @@ namespace {
                 if (token.type == TokenType::END) isRunning = false;
             }
         } catch (const CriticalLanguageException& e) {
-            LogCriticalError(e);
+            if (!quiet)
+                LogCriticalError(e);
         }
 
         globals.globalTable->WriteTable(output);
@@ -118,19 +189,21 @@ namespace {
         return globals.errorManager.GetStatus();
     }
 
-    int GenerateSemanticSymbols(std::istream& input, std::ostream& output) {
+    int GenerateSemanticSymbols(Source& input, std::ostream& output, const LexerOptions& lexerOptions, const ParserOptions& parserOptions, bool quiet) {
         Parser parser(input);
         GlobalState globals = {
+            .errorManager = ErrorManager(quiet),
             .syntaxPrint = SyntaxPrint::SYMBOLS,
-            .useSemantic = true
+            .useSemantic = true,
+            .lexerOptions = lexerOptions,
+            .parserOptions = parserOptions
         };
 
-        std::ostringstream ss;
-
         try {
-            parser.Parse(ss, globals);
+            parser.Parse(globals);
         } catch (const CriticalLanguageException& e) {
-            LogCriticalError(e);
+            if (!quiet)
+                LogCriticalError(e);
         }
 
         assert(globals.globalTable.has_value());
@@ -139,35 +212,35 @@ namespace {
         output << "\n";
         globals.globalTable = std::nullopt;
 
-        output << ss.str();
+        output << globals.tableOutput.view();
 
         return globals.errorManager.GetStatus();
     }
 
-    int GenerateSymbols(std::istream& input, std::ostream& output, bool useSemantic) {
+    int GenerateSymbols(Source& input, std::ostream& output, bool useSemantic, const LexerOptions& lexerOptions, const ParserOptions& parserOptions, bool quiet) {
         int status = 0;
 
         if (useSemantic)
-            status = GenerateSemanticSymbols(input, output);
+            status = GenerateSemanticSymbols(input, output, lexerOptions, parserOptions, quiet);
         else
-            status = GenerateLexicalSymbols(input, output);
+            status = GenerateLexicalSymbols(input, output, lexerOptions, quiet);
 
         return status;
     }
 
-    int GenerateSymbols(std::istream& input, const std::string& outputFileName, bool useSemantic) {
+    int GenerateSymbols(Source& input, const std::string& outputFileName, bool useSemantic, const LexerOptions& lexerOptions, const ParserOptions& parserOptions, bool quiet) {
         std::ofstream symbolsFile(outputFileName.empty() ? "symbols.txt" : outputFileName, std::ios::binary);
-        return GenerateSymbols(input, symbolsFile, useSemantic);
+        return GenerateSymbols(input, symbolsFile, useSemantic, lexerOptions, parserOptions, quiet);
     }
 
-    int GenerateSymbols(const std::string& inputFileName, const std::string& outputFileName, bool useSemantic) {
-        std::ifstream fileStream(inputFileName, std::ios::binary);
-        if (!fileStream) {
+    int GenerateSymbols(const std::string& inputFileName, const std::string& outputFileName, bool useSemantic, const LexerOptions& lexerOptions, const ParserOptions& parserOptions, bool quiet) {
+        auto source = Source::OpenFile(inputFileName);
+        if (!source.has_value()) {
             std::cerr << "No existe el archivo \"" << inputFileName << "\"." << std::endl;
             return 1;
         }
 
-        return GenerateSymbols(fileStream, outputFileName, useSemantic);
+        return GenerateSymbols(*source, outputFileName, useSemantic, lexerOptions, parserOptions, quiet);
     }
 }
 
@@ -175,6 +248,9 @@ namespace {
 Application::Application(const ApplicationAttributes& attributes)
     : m_taskType(attributes.taskType),
       m_useSemantic(attributes.useSemantic),
+      m_lexerOptions(attributes.lexerOptions),
+      m_parserOptions(attributes.parserOptions),
+      m_quiet(attributes.quiet),
       m_inputFileName(attributes.inputFileName),
       m_outputFileName(attributes.outputFileName) {
     if (m_taskType == TaskType::None)
@@ -190,26 +266,45 @@ int Application::Run() const {
             if (m_useSemantic)
                 std::cerr << "El análisis léxico no admite funcionalidad semántica." << std::endl;
 
-            if (m_inputFileName.empty())
-                result = GenerateTokens(std::cin, m_outputFileName);
-            else
-                result = GenerateTokens(m_inputFileName, m_outputFileName);
+            if (m_inputFileName.empty()) {
+                Source source = Source::OpenStandardInput();
+                result = GenerateTokens(source, m_outputFileName, m_lexerOptions, m_quiet);
+            } else {
+                result = GenerateTokens(m_inputFileName, m_outputFileName, m_lexerOptions, m_quiet);
+            }
+            break;
+        }
+
+        case TaskType::BinaryTokens: {
+            if (m_useSemantic)
+                std::cerr << "El análisis léxico no admite funcionalidad semántica." << std::endl;
+
+            if (m_inputFileName.empty()) {
+                Source source = Source::OpenStandardInput();
+                result = GenerateBinaryTokens(source, m_outputFileName, m_lexerOptions, m_quiet);
+            } else {
+                result = GenerateBinaryTokens(m_inputFileName, m_outputFileName, m_lexerOptions, m_quiet);
+            }
             break;
         }
 
         case TaskType::Symbols: {
-            if (m_inputFileName.empty())
-                result = GenerateSymbols(std::cin, m_outputFileName, m_useSemantic);
-            else
-                result = GenerateSymbols(m_inputFileName, m_outputFileName, m_useSemantic);
+            if (m_inputFileName.empty()) {
+                Source source = Source::OpenStandardInput();
+                result = GenerateSymbols(source, m_outputFileName, m_useSemantic, m_lexerOptions, m_parserOptions, m_quiet);
+            } else {
+                result = GenerateSymbols(m_inputFileName, m_outputFileName, m_useSemantic, m_lexerOptions, m_parserOptions, m_quiet);
+            }
             break;
         }
 
         case TaskType::Parse: {
-            if (m_inputFileName.empty())
-                result = GenerateParse(std::cin, m_outputFileName, m_useSemantic);
-            else
-                result = GenerateParse(m_inputFileName, m_outputFileName, m_useSemantic);
+            if (m_inputFileName.empty()) {
+                Source source = Source::OpenStandardInput();
+                result = GenerateParse(source, m_outputFileName, m_useSemantic, m_lexerOptions, m_parserOptions, m_quiet);
+            } else {
+                result = GenerateParse(m_inputFileName, m_outputFileName, m_useSemantic, m_lexerOptions, m_parserOptions, m_quiet);
+            }
             break;
         }
 
@@ -5,6 +5,9 @@
 class Application {
     TaskType m_taskType;
     bool m_useSemantic;
+    LexerOptions m_lexerOptions;
+    ParserOptions m_parserOptions;
+    bool m_quiet;
     std::string m_inputFileName;
     std::string m_outputFileName;
 
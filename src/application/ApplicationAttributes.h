@@ -1,14 +1,20 @@
 #pragma once
 
+#include "language/core/LexerOptions.h"
+#include "language/core/ParserOptions.h"
+
 #include <string>
 
 enum class TaskType {
-    None, Tokens, Symbols, Parse
+    None, Tokens, BinaryTokens, Symbols, Parse
 };
 
 struct ApplicationAttributes {
     TaskType taskType;
     bool useSemantic;
+    LexerOptions lexerOptions;
+    ParserOptions parserOptions;
+    bool quiet;
     std::string inputFileName;
     std::string outputFileName;
 };
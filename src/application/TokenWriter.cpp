@@ -0,0 +1,40 @@
+#include "TokenWriter.h"
+
+#include <iterator>
+
+void TokenWriter::Write(const Token& token) {
+    m_buffer += '<';
+    m_buffer += ToString(token.type);
+    m_buffer += ", ";
+
+    switch (token.type) {
+    case TokenType::CSTR:
+        m_buffer += '"';
+        AppendEscapedUtf8(m_literals.Get(token.GetLiteralIndex()), m_buffer);
+        m_buffer += '"';
+        break;
+
+    case TokenType::IDENTIFIER: {
+        const SymbolPos pos = token.GetSymbol();
+        std::format_to(std::back_inserter(m_buffer), "{}{}", pos.isLocal ? 'l' : 'g', pos.pos);
+        break;
+    }
+
+    case TokenType::CINT:
+        std::format_to(std::back_inserter(m_buffer), "{}", token.GetInteger());
+        break;
+
+    default:
+        break;
+    }
+
+    m_buffer += ">\n";
+
+    if (m_buffer.size() >= BLOCK_SIZE)
+        Flush();
+}
+
+void TokenWriter::Flush() {
+    m_output.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+    m_buffer.clear();
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "language/core/Token.h"
+#include "language/core/LiteralArena.h"
+
+#include <ostream>
+#include <string>
+
+/**
+ * Escribe la lista de tokens de la tarea «-t». Los tokens se formatean
+ * sobre un búfer propio, que se vuelca a la salida en bloques grandes.
+ */
+class TokenWriter {
+    static constexpr size_t BLOCK_SIZE = 256 * 1024;
+
+    std::ostream& m_output;
+    const LiteralArena& m_literals;
+    std::string m_buffer;
+
+public:
+    /**
+     * @param output La salida.
+     * @param literals Donde están los valores de las constantes de cadena.
+     */
+    TokenWriter(std::ostream& output, const LiteralArena& literals) : m_output(output), m_literals(literals) {
+        m_buffer.reserve(BLOCK_SIZE + 1024);
+    }
+
+    TokenWriter(const TokenWriter&) = delete;
+    TokenWriter& operator=(const TokenWriter&) = delete;
+
+    ~TokenWriter() { Flush(); }
+
+    /**
+     * Añade un token con el formato «<tipo, contenido>» y un salto de línea.
+     * @param token El token a escribir.
+     */
+    void Write(const Token& token);
+
+    /** Vuelca a la salida todo lo escrito hasta ahora. **/
+    void Flush();
+};
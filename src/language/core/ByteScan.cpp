@@ -0,0 +1,331 @@
+#include "ByteScan.h"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define PDL_X86_64
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(PDL_X86_64) && (defined(__GNUC__) || defined(__clang__))
+#define PDL_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define PDL_TARGET_AVX2
+#endif
+
+namespace {
+    constexpr uint64_t HIGH_BITS = 0x8080808080808080;
+
+    uint64_t LoadWord(const char* p) {
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        return word;
+    }
+
+    /** Versión escalar: comprueba el bloque de 8 en 8 bytes. **/
+    const char* FindNonAsciiScalar(const char* p, const char* const end) {
+        while (end - p >= 8) {
+            const uint64_t high = LoadWord(p) & HIGH_BITS;
+            if (high != 0) {
+                if constexpr (std::endian::native == std::endian::little)
+                    return p + std::countr_zero(high) / 8;
+                else
+                    return p + std::countl_zero(high) / 8;
+            }
+            p += 8;
+        }
+
+        while (p != end && (static_cast<unsigned char>(*p) & 0x80) == 0)
+            p += 1;
+
+        return p;
+    }
+
+#ifdef PDL_X86_64
+    bool HasAvx2() {
+#if defined(__GNUC__) || defined(__clang__)
+        // Se evalúa durante la inicialización estática, antes de que
+        // el compilador haya podido inicializar la detección por sí mismo.
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#else
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+            return false;
+
+        __cpuid(info, 1);
+        const bool osSaves = (info[2] & (1 << 27)) != 0;
+        const bool hasAvx = (info[2] & (1 << 28)) != 0;
+        if (!osSaves || !hasAvx || (_xgetbv(0) & 0x6) != 0x6)
+            return false;
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#endif
+    }
+
+    const bool HAS_AVX2 = HasAvx2();
+
+    const char* FindNonAsciiSse2(const char* p, const char* const end) {
+        while (end - p >= 16) {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            const int mask = _mm_movemask_epi8(block);
+            if (mask != 0)
+                return p + std::countr_zero(static_cast<unsigned>(mask));
+            p += 16;
+        }
+
+        return FindNonAsciiScalar(p, end);
+    }
+
+    PDL_TARGET_AVX2
+    const char* FindNonAsciiAvx2(const char* p, const char* const end) {
+        while (end - p >= 32) {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            const int mask = _mm256_movemask_epi8(block);
+            if (mask != 0)
+                return p + std::countr_zero(static_cast<unsigned>(mask));
+            p += 32;
+        }
+
+        return FindNonAsciiSse2(p, end);
+    }
+#endif
+
+    /*
+     * Búsquedas de la primera posición de un bloque en la que se detiene el
+     * analizador al saltar delimitadores o comentarios. Cada búsqueda se define
+     * con una clase con la condición de parada para un byte, para 16 bytes
+     * (SSE2) y para 32 bytes (AVX2), como máscara de bits.
+     */
+
+    /** Se detiene en todo lo que no sea un delimitador, y en los saltos de línea. **/
+    struct NonBlankSearch {
+        static bool Stops(const unsigned char c) {
+            return c != ' ' && (c < '\t' || c > '\r' || c == '\n');
+        }
+
+#ifdef PDL_X86_64
+        static unsigned StopMask(const __m128i block) {
+            // Un byte b está en [\t, \r] si min(b - \t, 4) == b - \t.
+            const __m128i offset = _mm_sub_epi8(block, _mm_set1_epi8('\t'));
+            const __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(4)), offset);
+            const __m128i newLine = _mm_cmpeq_epi8(block, _mm_set1_epi8('\n'));
+            const __m128i space = _mm_cmpeq_epi8(block, _mm_set1_epi8(' '));
+            const __m128i blank = _mm_or_si128(space, _mm_andnot_si128(newLine, control));
+            return ~static_cast<unsigned>(_mm_movemask_epi8(blank)) & 0xFFFF;
+        }
+
+        PDL_TARGET_AVX2
+        static unsigned StopMask(const __m256i block) {
+            const __m256i offset = _mm256_sub_epi8(block, _mm256_set1_epi8('\t'));
+            const __m256i control = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(4)), offset);
+            const __m256i newLine = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n'));
+            const __m256i space = _mm256_cmpeq_epi8(block, _mm256_set1_epi8(' '));
+            const __m256i blank = _mm256_or_si256(space, _mm256_andnot_si256(newLine, control));
+            return ~static_cast<unsigned>(_mm256_movemask_epi8(blank));
+        }
+#endif
+    };
+
+    /** Se detiene en los asteriscos, los saltos de línea y los bytes no ASCII. **/
+    struct CommentStopSearch {
+        static bool Stops(const unsigned char c) {
+            return c == '*' || c == '\n' || c >= 0x80;
+        }
+
+#ifdef PDL_X86_64
+        static unsigned StopMask(const __m128i block) {
+            const __m128i star = _mm_cmpeq_epi8(block, _mm_set1_epi8('*'));
+            const __m128i newLine = _mm_cmpeq_epi8(block, _mm_set1_epi8('\n'));
+            return static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(star, newLine), block)));
+        }
+
+        PDL_TARGET_AVX2
+        static unsigned StopMask(const __m256i block) {
+            const __m256i star = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('*'));
+            const __m256i newLine = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n'));
+            return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(star, newLine), block)));
+        }
+#endif
+    };
+
+    /** Se detiene en todo lo que no sea una letra o un dígito ASCII o un guion bajo. **/
+    struct IdentifierEndSearch {
+        /** Mapa de bits de los bytes que pueden continuar un identificador. **/
+        static constexpr std::array<uint64_t, 4> IDENTIFIER_BYTES = [] {
+            std::array<uint64_t, 4> bytes {};
+            for (unsigned c = 0; c < 128; c++) {
+                if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_')
+                    bytes[c / 64] |= uint64_t { 1 } << (c % 64);
+            }
+            return bytes;
+        }();
+
+        static bool Stops(const unsigned char c) {
+            return (IDENTIFIER_BYTES[c / 64] >> (c % 64) & 1) == 0;
+        }
+
+#ifdef PDL_X86_64
+        static unsigned StopMask(const __m128i block) {
+            // Como en los delimitadores, los rangos se comprueban con un mínimo sin signo.
+            // Con el bit 0x20, las mayúsculas pasan a minúsculas.
+            const __m128i letterOffset = _mm_sub_epi8(_mm_or_si128(block, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+            const __m128i letter = _mm_cmpeq_epi8(_mm_min_epu8(letterOffset, _mm_set1_epi8(25)), letterOffset);
+            const __m128i digitOffset = _mm_sub_epi8(block, _mm_set1_epi8('0'));
+            const __m128i digit = _mm_cmpeq_epi8(_mm_min_epu8(digitOffset, _mm_set1_epi8(9)), digitOffset);
+            const __m128i underscore = _mm_cmpeq_epi8(block, _mm_set1_epi8('_'));
+            const __m128i identifier = _mm_or_si128(_mm_or_si128(letter, digit), underscore);
+            return ~static_cast<unsigned>(_mm_movemask_epi8(identifier)) & 0xFFFF;
+        }
+
+        PDL_TARGET_AVX2
+        static unsigned StopMask(const __m256i block) {
+            const __m256i letterOffset = _mm256_sub_epi8(_mm256_or_si256(block, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+            const __m256i letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letterOffset, _mm256_set1_epi8(25)), letterOffset);
+            const __m256i digitOffset = _mm256_sub_epi8(block, _mm256_set1_epi8('0'));
+            const __m256i digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digitOffset, _mm256_set1_epi8(9)), digitOffset);
+            const __m256i underscore = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('_'));
+            const __m256i identifier = _mm256_or_si256(_mm256_or_si256(letter, digit), underscore);
+            return ~static_cast<unsigned>(_mm256_movemask_epi8(identifier));
+        }
+#endif
+    };
+
+    /** Se detiene en todo lo que no sea un carácter ASCII imprimible sin tratamiento en una cadena. **/
+    struct StringStopSearch {
+        static bool Stops(const unsigned char c) {
+            return c < ' ' || c > '~' || c == '\'' || c == '\\';
+        }
+
+#ifdef PDL_X86_64
+        static unsigned StopMask(const __m128i block) {
+            const __m128i offset = _mm_sub_epi8(block, _mm_set1_epi8(' '));
+            const __m128i printable = _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8('~' - ' ')), offset);
+            const __m128i quote = _mm_cmpeq_epi8(block, _mm_set1_epi8('\''));
+            const __m128i backslash = _mm_cmpeq_epi8(block, _mm_set1_epi8('\\'));
+            const __m128i plain = _mm_andnot_si128(_mm_or_si128(quote, backslash), printable);
+            return ~static_cast<unsigned>(_mm_movemask_epi8(plain)) & 0xFFFF;
+        }
+
+        PDL_TARGET_AVX2
+        static unsigned StopMask(const __m256i block) {
+            const __m256i offset = _mm256_sub_epi8(block, _mm256_set1_epi8(' '));
+            const __m256i printable = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8('~' - ' ')), offset);
+            const __m256i quote = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\''));
+            const __m256i backslash = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\\'));
+            const __m256i plain = _mm256_andnot_si256(_mm256_or_si256(quote, backslash), printable);
+            return ~static_cast<unsigned>(_mm256_movemask_epi8(plain));
+        }
+#endif
+    };
+
+    /** Se detiene en todo lo que no sea un dígito ASCII. **/
+    struct DigitEndSearch {
+        static bool Stops(const unsigned char c) {
+            return c < '0' || c > '9';
+        }
+
+#ifdef PDL_X86_64
+        static unsigned StopMask(const __m128i block) {
+            const __m128i offset = _mm_sub_epi8(block, _mm_set1_epi8('0'));
+            const __m128i digit = _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(9)), offset);
+            return ~static_cast<unsigned>(_mm_movemask_epi8(digit)) & 0xFFFF;
+        }
+
+        PDL_TARGET_AVX2
+        static unsigned StopMask(const __m256i block) {
+            const __m256i offset = _mm256_sub_epi8(block, _mm256_set1_epi8('0'));
+            const __m256i digit = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(9)), offset);
+            return ~static_cast<unsigned>(_mm256_movemask_epi8(digit));
+        }
+#endif
+    };
+
+    template<typename Search>
+    const char* FindStopScalar(const char* p, const char* const end) {
+        while (p != end && !Search::Stops(static_cast<unsigned char>(*p)))
+            p += 1;
+
+        return p;
+    }
+
+#ifdef PDL_X86_64
+    template<typename Search>
+    const char* FindStopSse2(const char* p, const char* const end) {
+        while (end - p >= 16) {
+            const unsigned mask = Search::StopMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+            if (mask != 0)
+                return p + std::countr_zero(mask);
+            p += 16;
+        }
+
+        return FindStopScalar<Search>(p, end);
+    }
+
+    template<typename Search>
+    PDL_TARGET_AVX2
+    const char* FindStopAvx2(const char* p, const char* const end) {
+        while (end - p >= 32) {
+            const unsigned mask = Search::StopMask(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+            if (mask != 0)
+                return p + std::countr_zero(mask);
+            p += 32;
+        }
+
+        return FindStopSse2<Search>(p, end);
+    }
+#endif
+
+    template<typename Search>
+    const char* FindStop(const char* begin, const char* end) {
+#ifdef PDL_X86_64
+        // Los tramos cortos son lo habitual (la sangría de una línea): no compensa usar AVX2.
+        if (HAS_AVX2 && end - begin >= 64)
+            return FindStopAvx2<Search>(begin, end);
+
+        return FindStopSse2<Search>(begin, end);
+#else
+        return FindStopScalar<Search>(begin, end);
+#endif
+    }
+}
+
+const char* FindNonAscii(const char* begin, const char* end) {
+#ifdef PDL_X86_64
+    if (HAS_AVX2)
+        return FindNonAsciiAvx2(begin, end);
+
+    return FindNonAsciiSse2(begin, end);
+#else
+    return FindNonAsciiScalar(begin, end);
+#endif
+}
+
+const char* FindNonBlank(const char* begin, const char* end) {
+    return FindStop<NonBlankSearch>(begin, end);
+}
+
+const char* FindCommentStop(const char* begin, const char* end) {
+    return FindStop<CommentStopSearch>(begin, end);
+}
+
+const char* FindIdentifierEnd(const char* begin, const char* end) {
+    return FindStop<IdentifierEndSearch>(begin, end);
+}
+
+
+const char* FindStringStop(const char* begin, const char* end) {
+    return FindStop<StringStopSearch>(begin, end);
+}
+
+const char* FindDigitEnd(const char* begin, const char* end) {
+    return FindStop<DigitEndSearch>(begin, end);
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+/**
+ * Busca el primer byte que no es ASCII (mayor o igual que 0x80) en un bloque.
+ * Usa instrucciones vectoriales (AVX2 o SSE2) si el procesador las admite.
+ * @param begin El inicio del bloque.
+ * @param end El final del bloque.
+ * @return La posición del primer byte no ASCII, o el final si no hay ninguno.
+ */
+const char* FindNonAscii(const char* begin, const char* end);
+
+/**
+ * Busca el primer byte de un bloque que no es un delimitador ASCII (espacio,
+ * tabulador, retorno de carro...). Los saltos de línea no se saltan, para
+ * que el analizador pueda llevar la cuenta de las líneas.
+ * @param begin El inicio del bloque.
+ * @param end El final del bloque.
+ * @return La posición del primer byte que no es un delimitador, o el final.
+ */
+const char* FindNonBlank(const char* begin, const char* end);
+
+/**
+ * Busca en el cuerpo de un comentario de bloque el primer byte que puede
+ * cambiar su estado o la cuenta de líneas y columnas: un asterisco, un salto
+ * de línea o el inicio de un carácter no ASCII.
+ * @param begin El inicio del bloque.
+ * @param end El final del bloque.
+ * @return La posición del primer byte encontrado, o el final.
+ */
+const char* FindCommentStop(const char* begin, const char* end);
+
+/**
+ * Busca el primer byte de un bloque que no puede continuar un identificador
+ * ASCII (letras, dígitos y guion bajo). Los bytes no ASCII también detienen
+ * la búsqueda: sus caracteres se deben clasificar uno a uno.
+ * @param begin El inicio del bloque.
+ * @param end El final del bloque.
+ * @return La posición del primer byte que no es de un identificador ASCII, o el final.
+ */
+const char* FindIdentifierEnd(const char* begin, const char* end);
+
+/**
+ * Busca en el cuerpo de una cadena el primer byte que no se puede copiar tal
+ * cual: una comilla, una barra invertida, un carácter no imprimible (que no
+ * se admite en las cadenas) o el inicio de un carácter no ASCII.
+ * @param begin El inicio del bloque.
+ * @param end El final del bloque.
+ * @return La posición del primer byte encontrado, o el final.
+ */
+const char* FindStringStop(const char* begin, const char* end);
+
+/**
+ * Busca el primer byte de un bloque que no es un dígito ASCII.
+ * @param begin El inicio del bloque.
+ * @param end El final del bloque.
+ * @return La posición del primer byte que no es un dígito, o el final.
+ */
+const char* FindDigitEnd(const char* begin, const char* end);
\ No newline at end of file
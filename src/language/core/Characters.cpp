@@ -2,19 +2,21 @@
 // https://www.unicode.org/versions/Unicode16.0.0/core-spec/chapter-3/#G7404#include
 
 #include "Characters.h"
+#include "ByteScan.h"
 
 #include <cassert>
+#include <cstring>
 #include <sstream>
 
 namespace {
     typedef unsigned char uchar;
 
-    template<size_t count>
-    constexpr char32_t AppendUnicodeBytes(const char32_t source, std::istream& input) {
+    template<size_t count, typename Reader>
+    constexpr char32_t AppendUnicodeBytes(const char32_t source, Reader& read) {
         char32_t codepoint = source;
 
         for (size_t i = 0; i < count; i++) {
-            const int c = input.get();
+            const int c = read();
             if (c == EOF || (c & ~0x3F) != 0x80) return U'\uFFFD';
 
             codepoint = codepoint << 6 | static_cast<uchar>(c) & 0x3F;
@@ -23,53 +25,164 @@ namespace {
         return codepoint;
     }
 
+    /**
+     * Decodifica el siguiente punto de código. La función de lectura
+     * devuelve el siguiente byte de la entrada o EOF si se ha terminado.
+     */
+    template<typename Reader>
+    constexpr char32_t DecodeUtf8Codepoint(Reader& read) {
+        const int readChar = read();
+        if (readChar == EOF) return static_cast<char32_t>(EOF);
+        char32_t codepoint;
+
+        // Carácter ASCII.
+        if ((readChar & ~0x7F) == 0x00) {
+            codepoint = static_cast<uchar>(readChar) & 0x7F;
+        }
+        // Carácter de dos bytes.
+        else if ((readChar & ~0x1F) == 0xC0) {
+            // Los caracteres de dos bytes que empiezan
+            // por 0xC0 o 0xC1 no son válidos.
+            if (readChar == 0xC0 || readChar == 0xC1) {
+                codepoint = U'\uFFFD';
+            } else {
+                codepoint = static_cast<uchar>(readChar) & 0x1F;
+                codepoint = AppendUnicodeBytes<1>(codepoint, read);
+            }
+        }
+        // Carácter de tres bytes.
+        else if ((readChar & ~0x0F) == 0xE0) {
+            codepoint = static_cast<uchar>(readChar) & 0x0F;
+            codepoint = AppendUnicodeBytes<2>(codepoint, read);
+        }
+        // Carácter de cuatro bytes.
+        else if ((readChar & ~0x07) == 0xF0) {
+            codepoint = static_cast<uchar>(readChar) & 0x07;
+            codepoint = AppendUnicodeBytes<3>(codepoint, read);
+
+            // Cuando procesamos 4 bytes, nos aseguramos de
+            // que no se exceda el valor máximo.
+            if (codepoint > static_cast<char32_t>(0x10FFFF))
+                codepoint = U'\uFFFD';
+        }
+        // Carácter inválido.
+        else {
+            codepoint = U'\uFFFD';
+        }
+
+        return codepoint;
+    }
+
     constexpr char CharCast(const char32_t codepoint) {
         assert(codepoint < 0xFF);
         return static_cast<char>(static_cast<unsigned char>(codepoint));
     }
-}
 
-char32_t ReadUtf8Codepoint(std::istream& input) {
-    const int readChar = input.get();
-    if (readChar == EOF) return static_cast<char32_t>(EOF);
-    char32_t codepoint;
+    /**
+     * Codifica un punto de código en UTF-8 en su forma más corta.
+     * @return El número de bytes escritos.
+     */
+    constexpr size_t EncodeUtf8(const char32_t codepoint, char* out) {
+        if (codepoint < 0x80) {
+            out[0] = CharCast(codepoint);
+            return 1;
+        }
+        if (codepoint < 0x800) {
+            out[0] = CharCast((codepoint >> 6 & 0x1F) | 0xC0);
+            out[1] = CharCast((codepoint >> 0 & 0x3F) | 0x80);
+            return 2;
+        }
+        if (codepoint < 0x10000) {
+            out[0] = CharCast((codepoint >> 12 & 0x0F) | 0xE0);
+            out[1] = CharCast((codepoint >>  6 & 0x3F) | 0x80);
+            out[2] = CharCast((codepoint >>  0 & 0x3F) | 0x80);
+            return 3;
+        }
 
-    // Carácter ASCII.
-    if ((readChar & ~0x7F) == 0x00) {
-        codepoint = static_cast<uchar>(readChar) & 0x7F;
+        out[0] = CharCast((codepoint >> 18 & 0x07) | 0xF0);
+        out[1] = CharCast((codepoint >> 12 & 0x3F) | 0x80);
+        out[2] = CharCast((codepoint >>  6 & 0x3F) | 0x80);
+        out[3] = CharCast((codepoint >>  0 & 0x3F) | 0x80);
+        return 4;
     }
-    // Carácter de dos bytes.
-    else if ((readChar & ~0x1F) == 0xC0) {
-        // Los caracteres de dos bytes que empiezan
-        // por 0xC0 o 0xC1 no son válidos.
-        if (readChar == 0xC0 || readChar == 0xC1) {
-            codepoint = U'\uFFFD';
-        } else {
-            codepoint = static_cast<uchar>(readChar) & 0x1F;
-            codepoint = AppendUnicodeBytes<1>(codepoint, input);
+
+    /**
+     * Indica si la secuencia que empieza en el byte inicial está cortada por
+     * el final del bloque, de forma que su valor depende de los bytes siguientes.
+     */
+    bool IsTruncatedSequence(const char* lead, const char* end) {
+        const auto c = static_cast<uchar>(*lead);
+        size_t length;
+
+        if ((c & ~0x1F) == 0xC0 && c != 0xC0 && c != 0xC1) length = 2;
+        else if ((c & ~0x0F) == 0xE0) length = 3;
+        else if ((c & ~0x07) == 0xF0) length = 4;
+        else return false;
+
+        if (static_cast<size_t>(end - lead) >= length)
+            return false;
+
+        // Si alguno de los bytes disponibles no es de continuación,
+        // la secuencia ya es inválida independientemente de lo que siga.
+        for (const char* p = lead + 1; p != end; p++) {
+            if ((static_cast<uchar>(*p) & ~0x3F) != 0x80)
+                return false;
         }
+
+        return true;
     }
-    // Carácter de tres bytes.
-    else if ((readChar & ~0x0F) == 0xE0) {
-        codepoint = static_cast<uchar>(readChar) & 0x0F;
-        codepoint = AppendUnicodeBytes<2>(codepoint, input);
-    }
-    // Carácter de cuatro bytes.
-    else if ((readChar & ~0x07) == 0xF0) {
-        codepoint = static_cast<uchar>(readChar) & 0x07;
-        codepoint = AppendUnicodeBytes<3>(codepoint, input);
-
-        // Cuando procesamos 4 bytes, nos aseguramos de
-        // que no se exceda el valor máximo.
-        if (codepoint > static_cast<char32_t>(0x10FFFF))
-            codepoint = U'\uFFFD';
+}
+
+char32_t ReadUtf8Codepoint(std::istream& input) {
+    auto read = [&input] { return input.get(); };
+    return DecodeUtf8Codepoint(read);
+}
+
+char32_t ReadUtf8Codepoint(const char*& cursor, const char* const end) {
+    auto read = [&cursor, end] -> int {
+        return cursor != end ? static_cast<uchar>(*cursor++) : EOF;
+    };
+    return DecodeUtf8Codepoint(read);
+}
+
+const char* FindUnsanitizedUtf8(const char* cursor, const char* const end) {
+    while (true) {
+        cursor = FindNonAscii(cursor, end);
+        if (cursor == end)
+            return end;
+
+        // Una secuencia es correcta si, al decodificarla y volverla a
+        // codificar, obtenemos exactamente los mismos bytes.
+        const char* sequence = cursor;
+        char encoded[4];
+        const size_t length = EncodeUtf8(ReadUtf8Codepoint(cursor, end), encoded);
+        if (static_cast<size_t>(cursor - sequence) != length || std::memcmp(sequence, encoded, length) != 0)
+            return sequence;
     }
-    // Carácter inválido.
-    else {
-        codepoint = U'\uFFFD';
+}
+
+size_t SanitizeUtf8(const std::string_view input, const bool isFinal, std::string& output) {
+    const char* cursor = input.data();
+    const char* const end = input.data() + input.size();
+
+    while (cursor != end) {
+        // Copiamos de golpe todo el tramo que no necesita cambios.
+        const char* const valid = FindUnsanitizedUtf8(cursor, end);
+        output.append(cursor, valid);
+        cursor = valid;
+
+        if (cursor == end)
+            break;
+
+        if (!isFinal && IsTruncatedSequence(cursor, end))
+            break;
+
+        char encoded[4];
+        const size_t length = EncodeUtf8(ReadUtf8Codepoint(cursor, end), encoded);
+        output.append(encoded, length);
     }
 
-    return codepoint;
+    return cursor - input.data();
 }
 
 std::string CodepointToUtf8(const char32_t codepoint) {
@@ -1,7 +1,8 @@
 #pragma once
 
-#include <unicode/uchar.h>
+#include "language/core/UnicodeTables.h"
 
+#include <cctype>
 #include <string>
 #include <istream>
 
@@ -9,6 +10,23 @@ constexpr bool IsAscii(const char32_t c) {
     return (c & ~0x7F) == 0;
 }
 
+/**
+ * Consulta una propiedad Unicode en sus tablas (véase UnicodeTables.h).
+ * @param index El índice de bloques de la propiedad.
+ * @param blocks Los bloques de la propiedad.
+ * @param c El punto de código. Fuera del rango Unicode, no tiene la propiedad.
+ * @return Si el carácter tiene la propiedad.
+ */
+template<typename Index, typename Blocks>
+constexpr bool HasUnicodeProperty(const Index& index, const Blocks& blocks, const char32_t c) {
+    if (c >= index.size() * UnicodeTables::BLOCK_SIZE)
+        return false;
+
+    const UnicodeTables::UnicodeBlock& block = blocks[index[c / UnicodeTables::BLOCK_SIZE]];
+    const char32_t bit = c % UnicodeTables::BLOCK_SIZE;
+    return (block[bit / 64] >> (bit % 64) & 1) != 0;
+}
+
 constexpr bool IsPrintAscii(const char32_t c) {
     return IsAscii(c) && std::isprint(static_cast<unsigned char>(c));
 }
@@ -25,24 +43,24 @@ constexpr bool IsAlphaAscii(const char32_t c) {
     return IsAscii(c) && std::isalpha(static_cast<unsigned char>(c));
 }
 
-inline bool IsAlphaUnicode(const char32_t c) {
-    return u_isalpha(static_cast<UChar32>(c));
+constexpr bool IsAlphaUnicode(const char32_t c) {
+    return HasUnicodeProperty(UnicodeTables::ALPHA_INDEX, UnicodeTables::ALPHA_BLOCKS, c);
 }
 
 constexpr bool IsAlnumAscii(const char32_t c) {
     return IsAscii(c) && std::isalnum(static_cast<unsigned char>(c));
 }
 
-inline bool IsAlnumUnicode(const char32_t c) {
-    return u_isalnum(static_cast<UChar32>(c));
+constexpr bool IsAlnumUnicode(const char32_t c) {
+    return HasUnicodeProperty(UnicodeTables::ALNUM_INDEX, UnicodeTables::ALNUM_BLOCKS, c);
 }
 
 constexpr bool IsDigitAscii(const char32_t c) {
     return IsAscii(c) && std::isdigit(static_cast<unsigned char>(c));
 }
 
-inline bool IsPrintUnicode(const char32_t c) {
-    return u_isprint(static_cast<UChar32>(c));
+constexpr bool IsPrintUnicode(const char32_t c) {
+    return HasUnicodeProperty(UnicodeTables::PRINT_INDEX, UnicodeTables::PRINT_BLOCKS, c);
 }
 
 
@@ -93,6 +111,42 @@ constexpr std::string EscapeAsciiChar(const char c) {
     }
 }
 
+/**
+ * Indica si un byte de una cadena UTF-8 se muestra escapado.
+ * @param c El byte a comprobar.
+ * @return Si se debe escapar.
+ */
+constexpr bool IsEscapedAscii(const char c) {
+    switch (c) {
+    case '\\': case '\'': case '\0':
+    case '\n': case '\a': case '\t': case '\v': case '\f': case '\r':
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+/**
+ * Escapa los caracteres especiales ASCII de una cadena y añade el resultado
+ * a la salida. Los tramos sin caracteres especiales se copian de una vez.
+ * @param str La cadena a escapar.
+ * @param output La cadena a la que se añade el resultado.
+ */
+constexpr void AppendEscapedUtf8(const std::string_view str, std::string& output) {
+    auto run = str.begin();
+
+    for (auto it = str.begin(); it != str.end(); ++it) {
+        if (IsEscapedAscii(*it)) {
+            output.append(run, it);
+            output += EscapeAsciiChar(*it);
+            run = it + 1;
+        }
+    }
+
+    output.append(run, str.end());
+}
+
 /**
  * Escapa todos los caracteres especiales ASCII de una cadena.
  * @param str La cadena a escapar.
@@ -100,15 +154,7 @@ constexpr std::string EscapeAsciiChar(const char c) {
  */
 constexpr std::string EscapeUtf8String(const std::string_view str) {
     std::string result;
-
-    for (const char& c : str) {
-        if (!IsAscii(c)) {
-            result += c;
-        } else {
-            result += EscapeAsciiChar(c);
-        }
-    }
-
+    AppendEscapedUtf8(str, result);
     return result;
 }
 
@@ -119,6 +165,65 @@ constexpr std::string EscapeUtf8String(const std::string_view str) {
  */
 char32_t ReadUtf8Codepoint(std::istream& input);
 
+/**
+ * Retorna el siguiente punto de código Unicode de un bloque de bytes UTF-8.
+ * @param cursor La posición actual en el bloque. Avanza tras la lectura.
+ * @param end El final del bloque.
+ * @return El siguiente punto de código, en formato UTF-32.
+ */
+char32_t ReadUtf8Codepoint(const char*& cursor, const char* end);
+
+/**
+ * Busca la primera secuencia de un bloque UTF-8 que cambiaría al sanearlo:
+ * secuencias inválidas (que se leen como U+FFFD) o codificadas con más
+ * bytes de los necesarios. Los tramos ASCII se recorren vectorialmente.
+ * @param cursor El inicio del bloque.
+ * @param end El final del bloque.
+ * @return La posición de la secuencia, o el final si el bloque ya está saneado.
+ */
+const char* FindUnsanitizedUtf8(const char* cursor, const char* end);
+
+/**
+ * Sanea un bloque UTF-8 y lo añade a la salida. Cada punto de código que
+ * lee ReadUtf8Codepoint se escribe en su forma más corta, de forma que las
+ * secuencias inválidas pasan a ser U+FFFD igual que al leerlas una a una.
+ * @param input El bloque a sanear.
+ * @param isFinal Si es el último bloque de la entrada. Si no lo es, una
+ *                secuencia cortada al final del bloque se deja sin consumir.
+ * @param output La cadena a la que se añade el bloque saneado.
+ * @return El número de bytes consumidos de la entrada.
+ */
+size_t SanitizeUtf8(std::string_view input, bool isFinal, std::string& output);
+
+/**
+ * Retorna el siguiente punto de código de un bloque saneado con
+ * SanitizeUtf8. Como el bloque es válido, no se hace ninguna comprobación.
+ * @param cursor La posición actual en el bloque. Avanza tras la lectura.
+ * @return El siguiente punto de código, en formato UTF-32.
+ */
+inline char32_t ReadSanitizedCodepoint(const char*& cursor) {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(cursor);
+    const unsigned char lead = bytes[0];
+
+    if (lead < 0x80) {
+        cursor += 1;
+        return lead;
+    }
+
+    if (lead < 0xE0) {
+        cursor += 2;
+        return (lead & 0x1F) << 6 | (bytes[1] & 0x3F);
+    }
+
+    if (lead < 0xF0) {
+        cursor += 3;
+        return (lead & 0x0F) << 12 | (bytes[1] & 0x3F) << 6 | (bytes[2] & 0x3F);
+    }
+
+    cursor += 4;
+    return (lead & 0x07) << 18 | (bytes[1] & 0x3F) << 12 | (bytes[2] & 0x3F) << 6 | (bytes[3] & 0x3F);
+}
+
 /**
  * Convierte un punto unicode de UTF-32 a UTF-8.
  * @param codepoint El punto Unicode a representar en UTF-8.
@@ -3,8 +3,13 @@
 #include "language/errors/ErrorManager.h"
 #include "language/core/ValueProduct.h"
 #include "language/core/SymbolTable.h"
+#include "language/core/LiteralArena.h"
+#include "language/core/LexerOptions.h"
+#include "language/core/ParserOptions.h"
+#include "language/core/ParseTrace.h"
 
 #include <cstdio>
+#include <sstream>
 
 enum class SyntaxPrint {
     NONE, PARSE, SYMBOLS
@@ -21,9 +26,24 @@ struct GlobalState {
 
     ErrorManager errorManager;
 
+    /** Los nombres de los identificadores, compartidos por todas las tablas de símbolos. **/
+    IdentifierInterner interner;
+
+    /** Los valores de las constantes de cadena de los tokens. **/
+    LiteralArena literals;
+
     SyntaxPrint syntaxPrint = SyntaxPrint::NONE;
     bool useSemantic = true;
 
+    /** Las producciones aplicadas, con SyntaxPrint::PARSE. **/
+    ParseTrace parseTrace;
+
+    /** Las tablas de símbolos de las funciones según terminan, con SyntaxPrint::SYMBOLS. **/
+    std::ostringstream tableOutput;
+
+    LexerOptions lexerOptions;
+    ParserOptions parserOptions;
+
     std::optional<SymbolTable> globalTable;
     std::optional<SymbolTable> localTable;
 
@@ -36,7 +56,7 @@ struct GlobalState {
 
     size_t& CurrentOffset() { return localTable.has_value() ? localOffset : globalOffset; }
 
-    [[nodiscard]] constexpr std::optional<SymbolPos> SearchSymbol(const std::string& name) const {
+    [[nodiscard]] constexpr std::optional<SymbolPos> SearchSymbol(const InternId name) const {
         if (localTable.has_value()) {
             const auto result = localTable->SearchSymbol(name);
             if (result.has_value()) {
@@ -58,14 +78,35 @@ struct GlobalState {
         return std::nullopt;
     }
 
-    SymbolPos AddSymbol(const std::string& name) {
+    /**
+     * Busca el símbolo de un identificador en las tablas actuales y, si no
+     * está, lo añade: como variable global entera si está activa la
+     * declaración implícita, o en la tabla actual si no.
+     * @param name El nombre internado del identificador.
+     * @return La posición del símbolo.
+     */
+    SymbolPos ResolveIdentifier(const InternId name) {
+        if (const auto pos = SearchSymbol(name); pos.has_value())
+            return pos.value();
+
+        if (!implicitDeclaration)
+            return AddSymbol(name);
+
+        const auto pos = AddGlobalSymbol(name);
+        AddType(pos, ValueProduct { tInt });
+        AddOffset(pos, globalOffset);
+        globalOffset += wInt;
+        return pos;
+    }
+
+    SymbolPos AddSymbol(const InternId name) {
         return localTable.has_value()
-                   ? SymbolPos { .isLocal = true, .pos = localTable->AddSymbol(name) }
-                   : SymbolPos { .isLocal = false, .pos = globalTable->AddSymbol(name) };
+                   ? SymbolPos { .isLocal = true, .pos = localTable->AddSymbol(name, interner.GetName(name)) }
+                   : SymbolPos { .isLocal = false, .pos = globalTable->AddSymbol(name, interner.GetName(name)) };
     }
 
-    SymbolPos AddGlobalSymbol(const std::string& name) {
-        return SymbolPos { .isLocal = false, .pos = globalTable->AddSymbol(name) };
+    SymbolPos AddGlobalSymbol(const InternId name) {
+        return SymbolPos { .isLocal = false, .pos = globalTable->AddSymbol(name, interner.GetName(name)) };
     }
 
     [[nodiscard]] bool HasAttribute(SymbolPos pos, const std::string& name) const {
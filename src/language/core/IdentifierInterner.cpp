@@ -0,0 +1,81 @@
+#include "IdentifierInterner.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+namespace {
+    /** FNV-1a de 32 bits. Los identificadores son cortos, por lo que basta. **/
+    uint32_t HashName(const std::string_view name) {
+        uint32_t hash = 2166136261u;
+        for (const char c : name) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+}
+
+std::string_view IdentifierInterner::Store(const std::string_view name) {
+    if (name.size() > m_blockRemaining) {
+        // Un nombre más largo que un bloque ocupa un bloque propio.
+        const size_t size = std::max(name.size(), ARENA_BLOCK_SIZE);
+        m_blocks.push_back(std::make_unique_for_overwrite<char[]>(size));
+        m_blockCursor = m_blocks.back().get();
+        m_blockRemaining = size;
+    }
+
+    std::memcpy(m_blockCursor, name.data(), name.size());
+    const std::string_view stored(m_blockCursor, name.size());
+
+    m_blockCursor += name.size();
+    m_blockRemaining -= name.size();
+
+    return stored;
+}
+
+void IdentifierInterner::Grow() {
+    std::vector<Slot> slots(m_slots.size() * 2);
+    const size_t mask = slots.size() - 1;
+
+    for (const Slot& slot : m_slots) {
+        if (slot.id == EMPTY_SLOT)
+            continue;
+
+        size_t i = slot.hash & mask;
+        while (slots[i].id != EMPTY_SLOT)
+            i = (i + 1) & mask;
+
+        slots[i] = slot;
+    }
+
+    m_slots = std::move(slots);
+}
+
+InternId IdentifierInterner::Intern(const std::string_view name) {
+    assert(!name.empty());
+
+    const uint32_t hash = HashName(name);
+    const size_t mask = m_slots.size() - 1;
+
+    size_t i = hash & mask;
+    while (m_slots[i].id != EMPTY_SLOT) {
+        const Slot& slot = m_slots[i];
+        if (slot.hash == hash && m_names[slot.id] == name)
+            return slot.id;
+
+        i = (i + 1) & mask;
+    }
+
+    assert(m_names.size() < EMPTY_SLOT);
+    const auto id = static_cast<InternId>(m_names.size());
+    m_names.push_back(Store(name));
+    m_slots[i] = Slot { .hash = hash, .id = id };
+
+    if (m_names.size() * 2 > m_slots.size())
+        Grow();
+
+    return id;
+}
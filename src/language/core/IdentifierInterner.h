@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/** El identificador de un nombre internado. Dos nombres iguales tienen el mismo. **/
+using InternId = uint32_t;
+
+/**
+ * Guarda una única copia de cada nombre de identificador. Los nombres se
+ * copian en bloques de memoria que no se mueven nunca, por lo que sus vistas
+ * son válidas mientras exista el objeto, y se buscan con una tabla hash de
+ * direccionamiento abierto.
+ */
+class IdentifierInterner {
+    static constexpr size_t ARENA_BLOCK_SIZE = 64 * 1024;
+    static constexpr InternId EMPTY_SLOT = UINT32_MAX;
+
+    struct Slot {
+        uint32_t hash;
+        InternId id = EMPTY_SLOT;
+    };
+
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    char* m_blockCursor = nullptr;
+    size_t m_blockRemaining = 0;
+
+    std::vector<std::string_view> m_names;
+
+    // La capacidad es siempre una potencia de dos y se mantiene ocupada a menos de la mitad.
+    std::vector<Slot> m_slots = std::vector<Slot>(1024);
+
+    /** Copia un nombre al bloque actual, o a uno nuevo si no cabe. **/
+    std::string_view Store(std::string_view name);
+
+    /** Duplica la tabla hash y recoloca los nombres. **/
+    void Grow();
+
+public:
+    /**
+     * Obtiene el identificador de un nombre. Si el nombre es nuevo, se copia.
+     * @param name El nombre. No hace falta que siga siendo válido tras la llamada.
+     * @return El identificador del nombre.
+     */
+    InternId Intern(std::string_view name);
+
+    /** Obtiene el nombre de un identificador, válido mientras exista el objeto. **/
+    [[nodiscard]] std::string_view GetName(const InternId id) const {
+        return m_names[id];
+    }
+
+    /** Obtiene el número de nombres distintos. Los identificadores van de 0 a este número. **/
+    [[nodiscard]] size_t GetCount() const {
+        return m_names.size();
+    }
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+/** Las opciones del analizador léxico. **/
+struct LexerOptions {
+    /** Si sólo se admiten caracteres ASCII fuera de las cadenas («--ascii»). **/
+    bool asciiOnly = false;
+
+    /**
+     * Si se analiza la entrada completa antes de entregar el primer token
+     * («--pretokenize»). Véase Lexer::Pretokenize.
+     */
+    bool pretokenize = false;
+
+    /**
+     * Los hilos con los que se analiza la entrada por adelantado
+     * («--lexer-threads»). Con cero, tantos como admita el equipo.
+     */
+    unsigned threads = 0;
+};
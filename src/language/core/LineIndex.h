@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+/** Una posición en la entrada, en líneas y caracteres (desde 1). **/
+struct SourceLocation {
+    unsigned line;
+    unsigned column;
+};
+
+/**
+ * Índice para traducir posiciones en bytes de la entrada a líneas y
+ * columnas. Se construye durante el análisis léxico y sólo se consulta
+ * al mostrar un error, por lo que las consultas son búsquedas binarias.
+ *
+ * Al leer la entrada por bloques, se olvidan las líneas que ya no se
+ * pueden consultar (véase Forget), para que la memoria del análisis léxico
+ * no dependa del tamaño de la entrada.
+ */
+class LineIndex {
+    struct WideCharacter {
+        /** La posición del primer byte del carácter. **/
+        size_t offset;
+        /** Los bytes de más de todos los caracteres hasta este, incluido. **/
+        size_t extraBytes;
+    };
+
+    std::vector<size_t> m_lineStarts { 0 };
+
+    /** El número de líneas olvidadas, anteriores a la primera de m_lineStarts. **/
+    size_t m_forgottenLines = 0;
+
+    // Las columnas cuentan caracteres, no bytes. Se guardan los caracteres
+    // de más de un byte para descontarlos; el resto de caracteres son ASCII.
+    std::vector<WideCharacter> m_wideCharacters;
+
+    /** Los bytes de más de los caracteres olvidados. **/
+    size_t m_forgottenExtraBytes = 0;
+
+    /** Los bytes de más de todos los caracteres anteriores a la posición. **/
+    [[nodiscard]] size_t GetExtraBytesBefore(const size_t offset) const {
+        const auto it = std::ranges::lower_bound(m_wideCharacters, offset, {}, &WideCharacter::offset);
+        return it == m_wideCharacters.begin() ? m_forgottenExtraBytes : std::prev(it)->extraBytes;
+    }
+
+public:
+    /**
+     * Registra el inicio de una nueva línea.
+     * @param offset La posición del primer byte de la línea.
+     */
+    void AddLine(const size_t offset) {
+        assert(offset >= m_lineStarts.back());
+        m_lineStarts.push_back(offset);
+    }
+
+    /**
+     * Registra un carácter que ocupa más de un byte.
+     * @param offset La posición del primer byte del carácter.
+     * @param size Los bytes que ocupa el carácter.
+     */
+    void AddWideCharacter(const size_t offset, const size_t size) {
+        assert(size > 1);
+        assert(m_wideCharacters.empty() || offset > m_wideCharacters.back().offset);
+
+        const size_t previous = m_wideCharacters.empty() ? m_forgottenExtraBytes : m_wideCharacters.back().extraBytes;
+        m_wideCharacters.push_back({ offset, previous + size - 1 });
+    }
+
+    /**
+     * Añade las líneas y los caracteres que otro índice tiene en un tramo de
+     * la entrada, para unir los índices de fragmentos analizados por separado.
+     * Los tramos se deben añadir en orden y sin huecos.
+     * @param other El índice del fragmento.
+     * @param begin El inicio del tramo. Una línea que empiece aquí ya es del tramo anterior.
+     * @param end El final del tramo.
+     */
+    void Append(const LineIndex& other, const size_t begin, const size_t end) {
+        for (auto it = std::ranges::upper_bound(other.m_lineStarts, begin); it != other.m_lineStarts.end() && *it <= end; ++it)
+            AddLine(*it);
+
+        // Los bytes de más se acumulan desde el principio de cada índice.
+        size_t otherPrevious = other.GetExtraBytesBefore(begin);
+        auto it = std::ranges::lower_bound(other.m_wideCharacters, begin, {}, &WideCharacter::offset);
+        for (; it != other.m_wideCharacters.end() && it->offset < end; ++it) {
+            AddWideCharacter(it->offset, it->extraBytes - otherPrevious + 1);
+            otherPrevious = it->extraBytes;
+        }
+    }
+
+    /**
+     * Olvida las líneas que terminan antes de una posición, y sus caracteres,
+     * conservando la cuenta de líneas. Las posiciones olvidadas ya no se
+     * pueden localizar. Para no mover el resto en cada llamada, sólo se
+     * olvidan cuando son al menos la mitad de las líneas guardadas.
+     * @param offset La primera posición que se debe poder localizar.
+     */
+    void Forget(const size_t offset) {
+        const auto line = std::ranges::upper_bound(m_lineStarts, offset);
+        if (line == m_lineStarts.begin())
+            return;
+
+        const auto forgotten = std::prev(line) - m_lineStarts.begin();
+        if (static_cast<size_t>(forgotten) * 2 < m_lineStarts.size())
+            return;
+
+        m_forgottenLines += forgotten;
+        m_lineStarts.erase(m_lineStarts.begin(), std::prev(line));
+
+        const auto wide = std::ranges::lower_bound(m_wideCharacters, m_lineStarts.front(), {}, &WideCharacter::offset);
+        if (wide != m_wideCharacters.begin())
+            m_forgottenExtraBytes = std::prev(wide)->extraBytes;
+
+        m_wideCharacters.erase(m_wideCharacters.begin(), wide);
+    }
+
+    /** Obtiene la posición del primer byte de la línea que contiene una posición. **/
+    [[nodiscard]] size_t GetLineStart(const size_t offset) const {
+        const auto it = std::ranges::upper_bound(m_lineStarts, offset);
+        assert(it != m_lineStarts.begin());
+        return *std::prev(it);
+    }
+
+    /**
+     * Obtiene la línea y la columna de una posición de la entrada.
+     * @param offset La posición del byte. Puede estar más allá del final
+     *               de la entrada, como la del token de fin de fichero,
+     *               pero no en una línea olvidada.
+     */
+    [[nodiscard]] SourceLocation Locate(const size_t offset) const {
+        assert(offset >= m_lineStarts.front());
+
+        const auto it = std::ranges::upper_bound(m_lineStarts, offset);
+        assert(it != m_lineStarts.begin());
+
+        const size_t lineStart = *std::prev(it);
+        const size_t extraBytes = GetExtraBytesBefore(offset) - GetExtraBytesBefore(lineStart);
+
+        return {
+            .line = static_cast<unsigned>(m_forgottenLines + (it - m_lineStarts.begin())),
+            .column = static_cast<unsigned>(offset - lineStart - extraBytes + 1)
+        };
+    }
+};
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Los valores de las constantes de cadena. Los bytes de todas las constantes
+ * se guardan seguidos en un único búfer, y los tokens se refieren a ellas
+ * por su índice. El analizador léxico escribe cada constante directamente
+ * en el búfer mientras la lee.
+ */
+class LiteralArena {
+    struct Literal {
+        size_t offset;
+        size_t length;
+    };
+
+    std::string m_bytes;
+    std::vector<Literal> m_literals;
+
+    /** Los bytes de las constantes terminadas. El resto son de la constante en curso. **/
+    size_t m_finishedSize = 0;
+
+public:
+    /** Empieza una constante nueva, descartando la anterior si no se terminó. **/
+    void Start() {
+        m_bytes.resize(m_finishedSize);
+    }
+
+    /** Añade bytes a la constante en curso. **/
+    void Append(const std::string_view bytes) {
+        m_bytes += bytes;
+    }
+
+    /** Añade un byte a la constante en curso. **/
+    void Append(const char c) {
+        m_bytes += c;
+    }
+
+    /**
+     * Termina la constante en curso.
+     * @return El índice de la constante.
+     */
+    uint32_t Finish() {
+        assert(m_literals.size() < UINT32_MAX);
+
+        m_literals.push_back({ m_finishedSize, m_bytes.size() - m_finishedSize });
+        m_finishedSize = m_bytes.size();
+
+        return static_cast<uint32_t>(m_literals.size() - 1);
+    }
+
+    /**
+     * Obtiene el valor de una constante.
+     * @param index El índice de la constante.
+     * @return Sus bytes, válidos hasta que se añada otra constante.
+     */
+    [[nodiscard]] std::string_view Get(const uint32_t index) const {
+        assert(index < m_literals.size());
+        const Literal& literal = m_literals[index];
+        return std::string_view(m_bytes).substr(literal.offset, literal.length);
+    }
+
+    /** Obtiene el número de constantes terminadas. Sus índices van de 0 a este número. **/
+    [[nodiscard]] uint32_t GetCount() const {
+        return static_cast<uint32_t>(m_literals.size());
+    }
+
+    /**
+     * Descarta todas las constantes, conservando la memoria reservada. Los
+     * índices anteriores dejan de ser válidos.
+     */
+    void Clear() {
+        m_bytes.clear();
+        m_literals.clear();
+        m_finishedSize = 0;
+    }
+};
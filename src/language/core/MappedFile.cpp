@@ -0,0 +1,138 @@
+#include "MappedFile.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    struct Mapping {
+        void* address;
+        size_t size;
+    };
+
+#ifdef _WIN32
+    /**
+     * Proyecta en memoria un fichero completo.
+     * @return La proyección, vacía si no se puede proyectar el fichero.
+     */
+    std::optional<Mapping> MapFile(const std::string& fileName) {
+        const HANDLE file = CreateFileA(
+            fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+        );
+        if (file == INVALID_HANDLE_VALUE)
+            return std::nullopt;
+
+        LARGE_INTEGER size;
+        if (GetFileType(file) != FILE_TYPE_DISK || !GetFileSizeEx(file, &size)) {
+            CloseHandle(file);
+            return std::nullopt;
+        }
+
+        // Un fichero vacío no se puede proyectar, pero sí se puede leer.
+        if (size.QuadPart == 0) {
+            CloseHandle(file);
+            return Mapping { .address = nullptr, .size = 0 };
+        }
+
+        const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr)
+            return std::nullopt;
+
+        void* address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (address == nullptr)
+            return std::nullopt;
+
+        // Pedimos al sistema que empiece a leer el fichero completo.
+        WIN32_MEMORY_RANGE_ENTRY range { address, static_cast<SIZE_T>(size.QuadPart) };
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+
+        return Mapping { .address = address, .size = static_cast<size_t>(size.QuadPart) };
+    }
+
+    void UnmapFile(const Mapping& mapping) noexcept {
+        UnmapViewOfFile(mapping.address);
+    }
+
+#else
+    /**
+     * Proyecta en memoria un fichero regular completo.
+     * @return La proyección, vacía si no se puede proyectar el fichero.
+     */
+    std::optional<Mapping> MapFile(const std::string& fileName) {
+        const int fd = open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1)
+            return std::nullopt;
+
+        struct stat status {};
+        if (fstat(fd, &status) == -1 || !S_ISREG(status.st_mode)) {
+            close(fd);
+            return std::nullopt;
+        }
+
+        // Un fichero vacío no se puede proyectar, pero sí se puede leer.
+        if (status.st_size == 0) {
+            close(fd);
+            return Mapping { .address = nullptr, .size = 0 };
+        }
+
+        const auto size = static_cast<size_t>(status.st_size);
+        void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (address == MAP_FAILED)
+            return std::nullopt;
+
+        // El analizador recorre el fichero de principio a fin una sola vez:
+        // pedimos una lectura anticipada agresiva y que se lea ya todo.
+        madvise(address, size, MADV_SEQUENTIAL);
+        madvise(address, size, MADV_WILLNEED);
+
+        return Mapping { .address = address, .size = size };
+    }
+
+    void UnmapFile(const Mapping& mapping) noexcept {
+        munmap(mapping.address, mapping.size);
+    }
+
+#endif
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_address(std::exchange(other.m_address, nullptr)),
+      m_size(std::exchange(other.m_size, 0)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        if (m_address != nullptr)
+            UnmapFile(Mapping { .address = m_address, .size = m_size });
+
+        m_address = std::exchange(other.m_address, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    if (m_address != nullptr)
+        UnmapFile(Mapping { .address = m_address, .size = m_size });
+}
+
+std::optional<MappedFile> MappedFile::Open(const std::string& fileName) {
+    const auto mapping = MapFile(fileName);
+    if (!mapping.has_value())
+        return std::nullopt;
+
+    return MappedFile(mapping->address, mapping->size);
+}
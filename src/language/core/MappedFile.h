@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/**
+ * Un fichero regular proyectado completo en memoria, de sólo lectura.
+ * La proyección se deshace al destruir el objeto.
+ */
+class MappedFile {
+    void* m_address = nullptr;
+    size_t m_size = 0;
+
+    MappedFile(void* address, const size_t size) : m_address(address), m_size(size) {}
+
+public:
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile();
+
+    /**
+     * Proyecta en memoria un fichero completo.
+     * @param fileName La ruta del fichero.
+     * @return La proyección, o vacío si el fichero no existe o no se puede
+     *         proyectar (p. ej., no es un fichero regular).
+     */
+    static std::optional<MappedFile> Open(const std::string& fileName);
+
+    /** Obtiene el contenido del fichero. **/
+    [[nodiscard]] std::string_view GetBytes() const {
+        return { static_cast<const char*>(m_address), m_size };
+    }
+};
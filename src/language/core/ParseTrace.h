@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * La traza del analizador sintáctico de la tarea «-p»: los números de las
+ * producciones aplicadas, un byte por producción, que se escriben de una vez
+ * al terminar el análisis.
+ */
+class ParseTrace {
+    static constexpr size_t BLOCK_SIZE = 256 * 1024;
+
+    /** El valor que marca un salto de línea. Las producciones empiezan en 1. **/
+    static constexpr uint8_t LINE_BREAK = 0;
+
+    /** El texto de cada entrada: « n» para las producciones y «\n» para los saltos de línea. **/
+    struct EntryText {
+        std::array<char, 4> text;
+        uint8_t length;
+    };
+
+    static constexpr std::array<EntryText, 256> ENTRY_TEXTS = [] {
+        std::array<EntryText, 256> texts {};
+        texts[LINE_BREAK] = { { '\n' }, 1 };
+
+        for (unsigned value = 1; value < texts.size(); value++) {
+            EntryText& entry = texts[value];
+            entry.text[entry.length++] = ' ';
+            if (value >= 100)
+                entry.text[entry.length++] = static_cast<char>('0' + value / 100);
+            if (value >= 10)
+                entry.text[entry.length++] = static_cast<char>('0' + value / 10 % 10);
+            entry.text[entry.length++] = static_cast<char>('0' + value % 10);
+        }
+
+        return texts;
+    }();
+
+    std::vector<uint8_t> m_entries;
+
+public:
+    /** Añade una producción, numeradas desde 1. **/
+    void AddProduction(const int production) {
+        assert(production > 0 && production <= UINT8_MAX);
+        m_entries.push_back(static_cast<uint8_t>(production));
+    }
+
+    void AddLineBreak() {
+        m_entries.push_back(LINE_BREAK);
+    }
+
+    /** Escribe la traza a la salida, en bloques grandes. **/
+    void Write(std::ostream& output) const {
+        std::string buffer;
+        buffer.reserve(BLOCK_SIZE + 4);
+
+        for (const uint8_t entry : m_entries) {
+            const EntryText& text = ENTRY_TEXTS[entry];
+            buffer.append(text.text.data(), text.length);
+
+            if (buffer.size() >= BLOCK_SIZE) {
+                output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                buffer.clear();
+            }
+        }
+
+        output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+};
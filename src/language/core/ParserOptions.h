@@ -0,0 +1,10 @@
+#pragma once
+
+/** Las opciones del analizador sintáctico. **/
+struct ParserOptions {
+    /**
+     * Si se analiza con la tabla LL(1) y una pila explícita en lugar de con
+     * el analizador recursivo («--table-parser»). Véase Parser::ParseWithTable.
+     */
+    bool tableDriven = false;
+};
@@ -0,0 +1,222 @@
+#include "Source.h"
+
+#include "language/core/Characters.h"
+
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+#ifdef _WIN32
+    int OpenDescriptor(const std::string& fileName) {
+        return _open(fileName.c_str(), _O_RDONLY | _O_BINARY);
+    }
+
+    int StandardInputDescriptor() {
+        _setmode(0, _O_BINARY);
+        return 0;
+    }
+
+    void CloseDescriptor(const int descriptor) noexcept {
+        _close(descriptor);
+    }
+
+    /**
+     * Lee del descriptor tantos bytes como haya disponibles, hasta el tamaño dado.
+     * @return Los bytes leídos. Cero al final de la entrada.
+     */
+    size_t ReadDescriptor(const int descriptor, char* buffer, const size_t size) {
+        const int result = _read(descriptor, buffer, static_cast<unsigned>(size));
+        return result > 0 ? static_cast<size_t>(result) : 0;
+    }
+#else
+    int OpenDescriptor(const std::string& fileName) {
+        return open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+    }
+
+    int StandardInputDescriptor() {
+        return STDIN_FILENO;
+    }
+
+    void CloseDescriptor(const int descriptor) noexcept {
+        close(descriptor);
+    }
+
+    /**
+     * Lee del descriptor tantos bytes como haya disponibles, hasta el tamaño dado.
+     * @return Los bytes leídos. Cero al final de la entrada.
+     */
+    size_t ReadDescriptor(const int descriptor, char* buffer, const size_t size) {
+        while (true) {
+            const ssize_t result = read(descriptor, buffer, size);
+            if (result >= 0)
+                return static_cast<size_t>(result);
+            if (errno != EINTR)
+                return 0;
+        }
+    }
+#endif
+}
+
+Source::Source(Source&& other) noexcept
+    : m_descriptor(std::exchange(other.m_descriptor, -1)),
+      m_ownsDescriptor(std::exchange(other.m_ownsDescriptor, false)),
+      m_mapping(std::move(other.m_mapping)),
+      m_bytes(std::exchange(other.m_bytes, {})),
+      m_delivered(other.m_delivered),
+      m_sanitized(std::move(other.m_sanitized)),
+      m_isSanitized(other.m_isSanitized),
+      m_chunk(std::move(other.m_chunk)),
+      m_pendingSize(other.m_pendingSize),
+      m_streamEnded(other.m_streamEnded) {}
+
+Source& Source::operator=(Source&& other) noexcept {
+    if (this != &other) {
+        Close();
+        m_descriptor = std::exchange(other.m_descriptor, -1);
+        m_ownsDescriptor = std::exchange(other.m_ownsDescriptor, false);
+        m_mapping = std::move(other.m_mapping);
+        m_bytes = std::exchange(other.m_bytes, {});
+        m_delivered = other.m_delivered;
+        m_sanitized = std::move(other.m_sanitized);
+        m_isSanitized = other.m_isSanitized;
+        m_chunk = std::move(other.m_chunk);
+        m_pendingSize = other.m_pendingSize;
+        m_streamEnded = other.m_streamEnded;
+    }
+
+    return *this;
+}
+
+Source::~Source() {
+    Close();
+}
+
+void Source::Close() noexcept {
+    if (m_ownsDescriptor) {
+        CloseDescriptor(m_descriptor);
+        m_ownsDescriptor = false;
+    }
+}
+
+void Source::SetMappedBytes(const std::string_view bytes) {
+    m_bytes = bytes;
+
+    // Lo habitual es que el fichero ya sea válido y se pueda recorrer
+    // directamente. Si no, se sanea una única vez a partir del primer error.
+    const char* const end = bytes.data() + bytes.size();
+    const char* const invalid = FindUnsanitizedUtf8(bytes.data(), end);
+
+    if (invalid != end) {
+        m_sanitized.reserve(bytes.size());
+        m_sanitized.append(bytes.data(), invalid);
+        SanitizeUtf8({ invalid, end }, true, m_sanitized);
+        m_isSanitized = true;
+    }
+}
+
+void Source::SetDescriptor(const int descriptor, const bool ownsDescriptor) {
+    m_descriptor = descriptor;
+    m_ownsDescriptor = ownsDescriptor;
+
+    // Al sanear, cada byte inválido puede pasar a ocupar tres (U+FFFD). Con
+    // esta capacidad, el búfer no tiene que crecer nunca durante la lectura.
+    m_chunk.resize(CHUNK_SIZE + 3);
+    m_sanitized.reserve(MAX_KEPT_SIZE + 3 * m_chunk.size());
+}
+
+std::optional<Source> Source::OpenFile(const std::string& fileName) {
+    Source source;
+
+    if (auto mapping = MappedFile::Open(fileName); mapping.has_value()) {
+        source.m_mapping = std::move(mapping);
+        source.SetMappedBytes(source.m_mapping->GetBytes());
+        return source;
+    }
+
+    // Si no se puede proyectar (p. ej., es una tubería con nombre), lo leemos por bloques.
+    const int descriptor = OpenDescriptor(fileName);
+    if (descriptor == -1)
+        return std::nullopt;
+
+    source.SetDescriptor(descriptor, true);
+    return source;
+}
+
+Source Source::OpenStandardInput() {
+    Source source;
+    source.SetDescriptor(StandardInputDescriptor(), false);
+    return source;
+}
+
+Source Source::FromSanitizedBytes(const std::string_view bytes) {
+    Source source;
+    source.m_bytes = bytes;
+    return source;
+}
+
+void Source::LoadAll() {
+    if (IsMapped())
+        return;
+
+    assert(m_sanitized.empty());
+
+    while (!m_streamEnded) {
+        const size_t readSize = ReadDescriptor(m_descriptor, m_chunk.data() + m_pendingSize, CHUNK_SIZE);
+        const size_t size = m_pendingSize + readSize;
+        m_streamEnded = readSize == 0;
+
+        const size_t consumed = SanitizeUtf8({ m_chunk.data(), size }, m_streamEnded, m_sanitized);
+        std::memmove(m_chunk.data(), m_chunk.data() + consumed, size - consumed);
+        m_pendingSize = size - consumed;
+    }
+
+    // A partir de aquí, la entrada se trata como si se hubiera proyectado.
+    Close();
+    m_descriptor = -1;
+    m_isSanitized = true;
+    m_chunk = {};
+}
+
+std::string_view Source::Refill(const size_t keep) {
+    assert(keep <= MAX_KEPT_SIZE);
+
+    if (IsMapped()) {
+        const std::string_view bytes = GetContents();
+        if (m_delivered)
+            return bytes.substr(bytes.size() - keep);
+
+        m_delivered = true;
+        return bytes;
+    }
+
+    // Los bytes conservados pasan al principio del búfer y los nuevos se
+    // añaden a continuación, de forma que el bloque siempre es contiguo.
+    assert(keep <= m_sanitized.size());
+    m_sanitized.erase(0, m_sanitized.size() - keep);
+
+    while (m_sanitized.size() == keep && !m_streamEnded) {
+        // Los bytes de una secuencia cortada en la lectura anterior siguen al principio.
+        const size_t readSize = ReadDescriptor(m_descriptor, m_chunk.data() + m_pendingSize, CHUNK_SIZE);
+        const size_t size = m_pendingSize + readSize;
+        m_streamEnded = readSize == 0;
+
+        const size_t consumed = SanitizeUtf8({ m_chunk.data(), size }, m_streamEnded, m_sanitized);
+        std::memmove(m_chunk.data(), m_chunk.data() + consumed, size - consumed);
+        m_pendingSize = size - consumed;
+    }
+
+    return m_sanitized;
+}
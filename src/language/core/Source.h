@@ -0,0 +1,106 @@
+#pragma once
+
+#include "language/core/MappedFile.h"
+
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/**
+ * La entrada del analizador léxico. Si la entrada es un fichero regular,
+ * se proyecta completo en memoria y el analizador recorre sus bytes de
+ * forma contigua. En otro caso (la entrada estándar, tuberías...), se
+ * lee por bloques de un descriptor sobre un búfer de tamaño fijo, por lo
+ * que la memoria usada no depende del tamaño de la entrada.
+ *
+ * En ambos casos, el analizador recibe los bytes ya saneados (véase
+ * SanitizeUtf8), por lo que puede decodificarlos sin comprobaciones.
+ */
+class Source {
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+public:
+    /** El máximo de bytes que se pueden conservar de un bloque al siguiente. **/
+    static constexpr size_t MAX_KEPT_SIZE = 64 * 1024;
+
+private:
+    int m_descriptor = -1;
+    bool m_ownsDescriptor = false;
+
+    std::optional<MappedFile> m_mapping;
+
+    std::string_view m_bytes;
+    bool m_delivered = false;
+
+    // Si la entrada está en memoria, su copia saneada (sólo si hace
+    // falta). Si no, el bloque actual, con capacidad fija.
+    std::string m_sanitized;
+    bool m_isSanitized = false;
+
+    // Los bytes leídos del descriptor pendientes de sanear.
+    std::string m_chunk;
+    size_t m_pendingSize = 0;
+    bool m_streamEnded = false;
+
+    Source() = default;
+
+    void Close() noexcept;
+
+    void SetMappedBytes(std::string_view bytes);
+
+    void SetDescriptor(int descriptor, bool ownsDescriptor);
+
+public:
+    Source(Source&& other) noexcept;
+    Source& operator=(Source&& other) noexcept;
+
+    Source(const Source&) = delete;
+    Source& operator=(const Source&) = delete;
+
+    ~Source();
+
+    /**
+     * Abre un fichero de entrada. Si es posible, se proyecta en memoria
+     * y, si no, se lee por bloques.
+     * @param fileName La ruta del fichero.
+     * @return La entrada, o vacío si no se ha podido abrir el fichero.
+     */
+    static std::optional<Source> OpenFile(const std::string& fileName);
+
+    /** Crea una entrada que lee por bloques de la entrada estándar. **/
+    static Source OpenStandardInput();
+
+    /**
+     * Crea una entrada sobre unos bytes en memoria ya saneados, sin copiarlos.
+     * @param bytes Los bytes, que deben ser válidos mientras se use la entrada.
+     */
+    static Source FromSanitizedBytes(std::string_view bytes);
+
+    /** Indica si la entrada es un bloque contiguo de bytes en memoria. **/
+    [[nodiscard]] bool IsMapped() const { return m_descriptor == -1; }
+
+    /**
+     * Lee completa una entrada por bloques, de forma que pase a estar en
+     * memoria. Se debe llamar antes de obtener el primer bloque.
+     */
+    void LoadAll();
+
+    /** Obtiene la entrada completa, saneada. Sólo si está en memoria. **/
+    [[nodiscard]] std::string_view GetContents() const {
+        assert(IsMapped());
+        return m_isSanitized ? std::string_view(m_sanitized) : m_bytes;
+    }
+
+    /**
+     * Obtiene el siguiente bloque de la entrada. Si la entrada está en
+     * memoria, el primer bloque es la entrada completa.
+     * @param keep El número de bytes del final del bloque anterior que se
+     *             deben conservar al principio del nuevo bloque. Como mucho,
+     *             MAX_KEPT_SIZE.
+     * @return El bloque saneado, válido hasta la siguiente llamada. Si se ha
+     *         llegado al final de la entrada, sólo contiene los bytes conservados.
+     */
+    std::string_view Refill(size_t keep);
+};
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <map>
 
 struct Symbol {
-    std::string lex;
+    /** El nombre, guardado en el IdentifierInterner del que procede. **/
+    std::string_view lex;
     std::map<std::string, std::string> attributes;
 };
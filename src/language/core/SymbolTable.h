@@ -1,19 +1,16 @@
 #pragma once
 
 #include "language/core/Symbol.h"
+#include "language/core/IdentifierInterner.h"
 
+#include <algorithm>
 #include <cassert>
+#include <optional>
 #include <vector>
 #include <map>
 #include <string>
 
 
-constexpr char aType[] = "type";
-constexpr char aValueType[] = "value_type";
-constexpr char aWidth[] = "width";
-constexpr char aSum[] = "sum";
-constexpr char aFunCall[] = "funCall";
-
 constexpr char tOk[] = "type_ok";
 constexpr char tError[] = "type_error";
 
@@ -29,24 +26,43 @@ constexpr int16_t wStr = 64;
 
 
 class SymbolTable {
+    static constexpr uint32_t NO_SYMBOL = UINT32_MAX;
+
     uint64_t m_tableId;
     std::vector<Symbol> m_symbols;
-    std::map<std::string, uint64_t> m_nameMap;
+
+    // La posición del símbolo de cada nombre, por su identificador internado.
+    // Sólo crece hasta el mayor identificador de la tabla.
+    std::vector<uint32_t> m_positions;
 
 public:
     explicit SymbolTable(uint64_t tableId) : m_tableId(tableId) {}
 
-    uint64_t AddSymbol(const std::string& name) {
+    /**
+     * Añade un símbolo a la tabla.
+     * @param id El identificador internado del nombre, que no debe estar en la tabla.
+     * @param name El nombre, que debe seguir siendo válido mientras exista la tabla.
+     * @return La posición del símbolo.
+     */
+    uint64_t AddSymbol(const InternId id, const std::string_view name) {
         assert(!name.empty());
-        assert(!m_nameMap.contains(name));
+        assert(!SearchSymbol(id).has_value());
 
-        uint64_t symbolPosition = m_symbols.size();
-        m_symbols.emplace_back(name);
-        m_nameMap.emplace(name, symbolPosition);
+        const uint64_t symbolPosition = m_symbols.size();
+        assert(symbolPosition < NO_SYMBOL);
+        m_symbols.push_back(Symbol { .lex = name });
+
+        if (id >= m_positions.size())
+            m_positions.resize(std::max<size_t>(id + 1, m_positions.size() * 2), NO_SYMBOL);
+        m_positions[id] = static_cast<uint32_t>(symbolPosition);
 
         return symbolPosition;
     }
 
+    [[nodiscard]] size_t GetSymbolCount() const {
+        return m_symbols.size();
+    }
+
     [[nodiscard]] std::string_view GetSymbolName(uint64_t pos) const {
         assert(m_symbols.size() > pos);
         return m_symbols[pos].lex;
@@ -77,11 +93,11 @@ public:
         return symbol.attributes.at(name);
     }
 
-    [[nodiscard]] std::optional<uint64_t> SearchSymbol(const std::string& name) const {
-        if (!m_nameMap.contains(name))
+    [[nodiscard]] std::optional<uint64_t> SearchSymbol(const InternId id) const {
+        if (id >= m_positions.size() || m_positions[id] == NO_SYMBOL)
             return std::nullopt;
 
-        return m_nameMap.at(name);
+        return m_positions[id];
     }
 
     void WriteTable(std::ostream& output) const {
@@ -3,10 +3,13 @@
 #include "language/core/Characters.h"
 #include "language/core/SymbolPos.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstdint>
+#include <iterator>
 #include <string>
-#include <variant>
+#include <type_traits>
 #include <format>
 #include <utility>
 
@@ -47,45 +50,177 @@ enum class TokenType : unsigned char {
 
 
 /**
- * La unidad básica del analizador léxico. Definido
- * mediante el tipo de token y su contenido.
+ * La unidad básica del analizador léxico. Definido mediante el tipo de
+ * token y su contenido. Ocupa 16 bytes y se puede copiar libremente: el
+ * valor de las constantes de cadena se guarda aparte (véase LiteralArena).
  */
 struct Token {
+    /** La longitud máxima que se guarda. Los tokens más largos se recortan. **/
+    static constexpr uint32_t MAX_LENGTH = (1u << 24) - 1;
+
+    /** La posición en bytes del token en la entrada. **/
+    size_t offset;
+
+    /**
+     * El contenido del token, según su tipo: la posición de un identificador
+     * en su tabla de símbolos (véase GetSymbol), el valor de una constante
+     * entera o el índice del valor de una constante de cadena. Cero en el resto.
+     * Mientras está en un TokenBuffer, un identificador guarda en su lugar su
+     * nombre internado.
+     */
+    uint32_t payload;
+
+    /** Los bytes que ocupa el token en la entrada, hasta MAX_LENGTH. **/
+    uint32_t length : 24;
+
     /** El identificador del token. **/
-    TokenType type {};
+    TokenType type : 8;
+
+    /** Codifica la posición de un símbolo como contenido de un token. **/
+    static uint32_t EncodeSymbol(const SymbolPos pos) {
+        assert(pos.pos <= UINT32_MAX >> 1);
+        return static_cast<uint32_t>(pos.pos << 1) | (pos.isLocal ? 1 : 0);
+    }
+
+    /** Codifica el valor de una constante entera como contenido de un token. **/
+    static uint32_t EncodeInteger(const int16_t value) {
+        return static_cast<uint16_t>(value);
+    }
+
+    /** Obtiene la posición en su tabla de símbolos de un identificador. **/
+    [[nodiscard]] SymbolPos GetSymbol() const {
+        assert(type == TokenType::IDENTIFIER);
+        return SymbolPos { .isLocal = (payload & 1) != 0, .pos = payload >> 1 };
+    }
+
+    /** Obtiene el valor de una constante entera. **/
+    [[nodiscard]] int16_t GetInteger() const {
+        assert(type == TokenType::CINT);
+        return static_cast<int16_t>(payload);
+    }
+
+    /** Obtiene el índice del valor de una constante de cadena en su LiteralArena. **/
+    [[nodiscard]] uint32_t GetLiteralIndex() const {
+        assert(type == TokenType::CSTR);
+        return payload;
+    }
+};
+
+static_assert(sizeof(Token) == 16);
+static_assert(std::is_trivially_copyable_v<Token>);
+
+/** Una palabra reservada y su token. **/
+struct Keyword {
+    std::string_view text;
+    TokenType type;
+};
+
+/** Las palabras reservadas. La tabla de búsqueda se genera a partir de esta lista. **/
+constexpr Keyword KEYWORDS[] = {
+    { "boolean", TokenType::BOOL },
+    { "for", TokenType::FOR },
+    { "function", TokenType::FUNCTION },
+    { "if", TokenType::IF },
+    { "input", TokenType::INPUT },
+    { "output", TokenType::OUTPUT },
+    { "int", TokenType::INT },
+    { "return", TokenType::RETURN },
+    { "string", TokenType::STRING },
+    { "var", TokenType::VAR },
+    { "void", TokenType::VOID },
+
+    { "false", TokenType::FALSE },
+    { "true", TokenType::TRUE }
+};
+
+/**
+ * Tabla hash perfecta de las palabras reservadas, generada al compilar: cada
+ * palabra ocupa una casilla distinta, así que basta con una comparación.
+ */
+class KeywordTable {
+    static constexpr unsigned BITS = 5;
+    static constexpr size_t SIZE = size_t { 1 } << BITS;
+
+    static_assert(std::size(KEYWORDS) <= SIZE);
+
+    /** La semilla del hash, que se busca hasta que no hay colisiones. **/
+    uint32_t m_seed = 0;
+    std::array<Keyword, SIZE> m_slots {};
+
+    size_t m_minLength = SIZE_MAX;
+    size_t m_maxLength = 0;
+    std::array<bool, 256> m_firstChars {};
+
+    /** El hash depende sólo de la longitud y del primer y el último carácter. **/
+    static constexpr size_t Hash(const std::string_view str, const uint32_t seed) {
+        const uint32_t key = static_cast<uint32_t>(str.size())
+            | static_cast<uint32_t>(static_cast<unsigned char>(str.front())) << 8
+            | static_cast<uint32_t>(static_cast<unsigned char>(str.back())) << 16;
+
+        // Hash multiplicativo de Fibonacci: los bits altos del producto son los que más se mezclan.
+        return ((key ^ seed) * 0x9E3779B1u) >> (32 - BITS);
+    }
+
+    constexpr bool TryBuild(const uint32_t seed) {
+        m_seed = seed;
+        m_slots = {};
+
+        for (const Keyword& keyword : KEYWORDS) {
+            Keyword& slot = m_slots[Hash(keyword.text, seed)];
+            if (!slot.text.empty())
+                return false;
+
+            slot = keyword;
+        }
+
+        return true;
+    }
+
+public:
+    constexpr KeywordTable() {
+        uint32_t seed = 0;
+        while (!TryBuild(seed)) {
+            seed += 1;
+            if (seed > 100'000)
+                throw "No se ha encontrado una tabla hash perfecta para las palabras reservadas.";
+        }
 
-    unsigned line;
-    unsigned column;
-    unsigned length;
+        for (const Keyword& keyword : KEYWORDS) {
+            m_minLength = std::min(m_minLength, keyword.text.size());
+            m_maxLength = std::max(m_maxLength, keyword.text.size());
+            m_firstChars[static_cast<unsigned char>(keyword.text.front())] = true;
+        }
+    }
 
     /**
-     * El contenido del token. Dependiendo del tipo puede estar vacío
-     * o ser un identificador, una cadena, o un entero de 16 bits con signo.
+     * Busca una palabra reservada.
+     * @param str El lexema a buscar.
+     * @return El token de la palabra reservada, o IDENTIFIER si no lo es.
      */
-    std::variant<std::monostate, SymbolPos, std::string, int16_t> attribute {};
+    [[nodiscard]] constexpr TokenType Search(const std::string_view str) const {
+        if (str.size() < m_minLength || str.size() > m_maxLength)
+            return TokenType::IDENTIFIER;
+
+        if (!m_firstChars[static_cast<unsigned char>(str.front())])
+            return TokenType::IDENTIFIER;
+
+        const Keyword& slot = m_slots[Hash(str, m_seed)];
+        return slot.text == str ? slot.type : TokenType::IDENTIFIER;
+    }
 };
 
+constexpr KeywordTable KEYWORD_TABLE {};
+
+static_assert(std::ranges::all_of(KEYWORDS, [](const Keyword& keyword) {
+    return KEYWORD_TABLE.Search(keyword.text) == keyword.type;
+}));
+
 /**
  * Convierte un token identificador a uno correspondiente
  * a una palabra reservada si es necesaria.
  */
 constexpr TokenType KeywordToToken(const std::string_view str) {
-    if (str == "boolean") return TokenType::BOOL;
-    if (str == "for") return TokenType::FOR;
-    if (str == "function") return TokenType::FUNCTION;
-    if (str == "if") return TokenType::IF;
-    if (str == "input") return TokenType::INPUT;
-    if (str == "output") return TokenType::OUTPUT;
-    if (str == "int") return TokenType::INT;
-    if (str == "return") return TokenType::RETURN;
-    if (str == "string") return TokenType::STRING;
-    if (str == "var") return TokenType::VAR;
-    if (str == "void") return TokenType::VOID;
-
-    if (str == "false") return TokenType::FALSE;
-    if (str == "true") return TokenType::TRUE;
-
-    return TokenType::IDENTIFIER;
+    return KEYWORD_TABLE.Search(str);
 }
 
 /**
@@ -178,24 +313,3 @@ constexpr const char* GetDisplayString(const TokenType token) noexcept {
 
     std::unreachable();
 }
-
-/**
- * Devuelve el valor del contenido de un token como texto.
- * @param token La variante con el contenido del token.
- * @return El valor del contenido en forma de texto.
- */
-constexpr std::string TokenAttributeToString(const auto& token) {
-    return std::visit(
-        []<typename U>(U&& arg) -> std::string {
-            if constexpr (std::is_same_v<std::decay_t<U>, std::string>)
-                return std::format("\"{}\"", EscapeUtf8String(arg));
-            else if constexpr (std::is_same_v<std::decay_t<U>, SymbolPos>)
-                return (arg.isLocal ? "l" : "g") + std::to_string(arg.pos);
-            else if constexpr (std::is_same_v<std::decay_t<U>, std::monostate>)
-                return "";
-            else
-                return std::to_string(arg);
-        },
-        token.attribute
-    );
-}
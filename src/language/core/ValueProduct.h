@@ -1,29 +1,60 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 #include <variant>
 
+/**
+ * Un valor de un atributo semántico: un tipo, un producto de tipos o un
+ * número. Los valores de un solo elemento, que son casi todos, se guardan
+ * sin vector, de modo que asignarlos no reserva memoria.
+ */
 class ValueProduct {
-    std::variant<std::monostate, std::vector<std::string>, std::vector<int16_t>> m_data;
+    std::variant<
+        std::monostate,
+        std::string,
+        int16_t,
+        std::vector<std::string>,
+        std::vector<int16_t>
+    > m_data;
 
 public:
     ValueProduct() = default;
 
-    explicit constexpr ValueProduct(const std::string& str) : m_data(std::vector { str }) {}
-    explicit constexpr ValueProduct(int16_t value) : m_data(std::vector { value }) {}
+    explicit constexpr ValueProduct(const std::string& str) : m_data(str) {}
+    explicit constexpr ValueProduct(int16_t value) : m_data(value) {}
 
-    [[nodiscard]] const auto& GetRawData() const { return m_data; }
+    [[nodiscard]] bool IsEmpty() const { return std::holds_alternative<std::monostate>(m_data); }
 
-    [[nodiscard]] const auto& GetStrings() const { return std::get<std::vector<std::string>>(m_data); }
+    [[nodiscard]] bool HoldsStrings() const {
+        return std::holds_alternative<std::string>(m_data) || std::holds_alternative<std::vector<std::string>>(m_data);
+    }
+
+    [[nodiscard]] std::span<const std::string> GetStrings() const {
+        if (const auto* str = std::get_if<std::string>(&m_data))
+            return { str, 1 };
+        return std::get<std::vector<std::string>>(m_data);
+    }
 
-    [[nodiscard]] const auto& GetNumbers() const { return std::get<std::vector<int16_t>>(m_data); }
+    [[nodiscard]] std::span<const int16_t> GetNumbers() const {
+        if (const auto* value = std::get_if<int16_t>(&m_data))
+            return { value, 1 };
+        return std::get<std::vector<int16_t>>(m_data);
+    }
 
     void Append(std::string_view s) {
         if (std::holds_alternative<std::monostate>(m_data)) {
+            m_data.emplace<std::string>(s);
+        } else if (const auto* str = std::get_if<std::string>(&m_data)) {
             std::vector<std::string> data;
+            data.reserve(2);
+            data.push_back(*str);
             data.emplace_back(s);
-            m_data = data;
+            m_data = std::move(data);
         } else if (std::holds_alternative<std::vector<std::string>>(m_data)) {
             auto& data = std::get<std::vector<std::string>>(m_data);
             data.emplace_back(s);
@@ -31,9 +62,17 @@ public:
     }
 
     void Append(const ValueProduct& a) {
+        if (std::holds_alternative<std::string>(m_data)) {
+            const std::string str = std::get<std::string>(m_data);
+            m_data = std::vector { str };
+        } else if (std::holds_alternative<int16_t>(m_data)) {
+            const int16_t value = std::get<int16_t>(m_data);
+            m_data = std::vector { value };
+        }
+
         if (std::holds_alternative<std::vector<std::string>>(m_data)) {
             auto& data = std::get<std::vector<std::string>>(m_data);
-            const auto& newData = std::get<std::vector<std::string>>(a.m_data);
+            const auto newData = a.GetStrings();
 
             data.reserve(data.size() + newData.size());
             for (const auto& s : newData) {
@@ -41,7 +80,7 @@ public:
             }
         } else if (std::holds_alternative<std::vector<int16_t>>(m_data)) {
             auto& data = std::get<std::vector<int16_t>>(m_data);
-            const auto& newData = std::get<std::vector<int16_t>>(a.m_data);
+            const auto newData = a.GetNumbers();
 
             data.reserve(data.size() + newData.size());
             for (const auto& s : newData) {
@@ -51,45 +90,28 @@ public:
     }
 
     ValueProduct& operator=(std::string_view s) {
-        if (std::holds_alternative<std::monostate>(m_data)) {
-            std::vector<std::string> data;
-            data.emplace_back(s);
-            m_data = data;
-        } else if (std::holds_alternative<std::vector<std::string>>(m_data)) {
-            auto& data = std::get<std::vector<std::string>>(m_data);
-            data.clear();
-            data.emplace_back(s);
+        if (auto* str = std::get_if<std::string>(&m_data)) {
+            str->assign(s);
         } else {
-            m_data = std::vector { std::string(s) };
+            m_data.emplace<std::string>(s);
         }
 
         return *this;
     }
 
     ValueProduct& operator=(int16_t a) {
-        if (std::holds_alternative<std::monostate>(m_data)) {
-            std::vector<int16_t> data;
-            data.emplace_back(a);
-            m_data = data;
-        } else if (std::holds_alternative<std::vector<int16_t>>(m_data)) {
-            auto& data = std::get<std::vector<int16_t>>(m_data);
-            data.clear();
-            data.emplace_back(a);
-        } else {
-            m_data = std::vector { a };
-        }
-
+        m_data = a;
         return *this;
     }
 
     operator int16_t() const {
-        const auto& data = std::get<std::vector<int16_t>>(m_data);
+        const auto data = GetNumbers();
         assert(data.size() == 1);
         return data[0];
     }
 
     operator std::string_view() const {
-        const auto& data = std::get<std::vector<std::string>>(m_data);
+        const auto data = GetStrings();
         assert(data.size() == 1);
         return data[0];
     }
@@ -98,8 +120,8 @@ public:
         if (std::holds_alternative<std::monostate>(m_data)) {
             return "Ø";
         }
-        if (std::holds_alternative<std::vector<std::string>>(m_data)) {
-            const auto& data = std::get<std::vector<std::string>>(m_data);
+        if (HoldsStrings()) {
+            const auto data = GetStrings();
             if (data.empty())
                 return "Ø";
 
@@ -111,8 +133,8 @@ public:
             result += data.back();
             return result;
         }
-        if (std::holds_alternative<std::vector<int16_t>>(m_data)) {
-            const auto& data = std::get<std::vector<int16_t>>(m_data);
+        if (std::holds_alternative<int16_t>(m_data) || std::holds_alternative<std::vector<int16_t>>(m_data)) {
+            const auto data = GetNumbers();
             if (data.empty())
                 return "Ø";
 
@@ -130,7 +152,15 @@ public:
 };
 
 constexpr bool operator==(const ValueProduct& a, const ValueProduct& b) {
-    return a.GetRawData() == b.GetRawData();
+    if (a.IsEmpty() || b.IsEmpty())
+        return a.IsEmpty() && b.IsEmpty();
+
+    if (a.HoldsStrings() != b.HoldsStrings())
+        return false;
+
+    return a.HoldsStrings()
+               ? std::ranges::equal(a.GetStrings(), b.GetStrings())
+               : std::ranges::equal(a.GetNumbers(), b.GetNumbers());
 }
 
 constexpr bool operator==(const ValueProduct& a, std::string_view b) {
@@ -3,41 +3,55 @@
 #include "language/process/Lexer.h"
 #include "language/process/Parser.h"
 
+#include <algorithm>
 #include <iostream>
 
 namespace {
+    void AppendHint(std::string& output, std::string_view line, unsigned column, unsigned length) {
+        output += " ->   ";
+        output += line;
+        output += "\n      ";
+        output.append(std::max(column, 1u) - 1, ' ');
+        output.append(length, '^');
+        output += '\n';
+    }
+
     void PrintHint(std::string_view line, unsigned column, unsigned length) {
-        std::string displayHint;
-        for (unsigned i = 1; i < column; i++) {
-            displayHint += " ";
-        }
-        for (unsigned i = 0; i < length; i++) {
-            displayHint += "^";
-        }
-
-        std::cerr << " ->   " << line << std::endl;
-        std::cerr << "      " << displayHint << std::endl;
+        std::string hint;
+        AppendHint(hint, line, column, length);
+        std::cerr << hint;
     }
 }
 
-void ErrorManager::ProcessLexicalException(Lexer& lexer, const LexicalException& e) {
-    std::cerr << std::format(
-        "({}:{}) LE-{:04X}: ",
-        e.GetLine(), e.GetColumn(),
-        static_cast<uint32_t>(e.GetCode())
-    );
-    std::cerr << e.what() << std::endl;
+void ErrorManager::ProcessLexicalError(Lexer& lexer, const LexicalDiagnostic& e) {
+    LogLexicalError(e, lexer.Locate(e.GetOffset()), lexer.GetCurrentLine());
+
+    if (m_lexicalMode == LexicalRecoveryMode::SkipLine)
+        lexer.SkipLine();
+}
 
-    PrintHint(lexer.GetCurrentLine(), e.GetColumn(), 1);
+void ErrorManager::LogLexicalError(
+    const LexicalDiagnostic& e,
+    const SourceLocation location,
+    const std::string_view currentLine
+) {
+    if (!m_quiet) {
+        // Con muchos errores, escribir cada uno de una vez evita una escritura por fragmento.
+        std::string message = std::format(
+            "({}:{}) LE-{:04X}: {}\n",
+            location.line, location.column,
+            static_cast<uint32_t>(e.GetCode()),
+            e.GetMessage()
+        );
+        AppendHint(message, currentLine, location.column, 1);
+        std::cerr << message;
+    }
 
     switch (m_lexicalMode) {
     case LexicalRecoveryMode::Critical:
         m_status = 2;
         throw CriticalLanguageException();
     case LexicalRecoveryMode::SkipLine:
-        m_status = 1;
-        lexer.SkipLine();
-        break;
     case LexicalRecoveryMode::SkipChar:
         m_status = 1;
         break;
@@ -45,15 +59,20 @@ void ErrorManager::ProcessLexicalException(Lexer& lexer, const LexicalException&
 }
 
 void ErrorManager::ProcessSyntaxException(Lexer& lexer, const SyntaxException& e) {
-    std::cerr << std::format(
-        "({}:{}) SE-{:04X}: ",
-        e.GetLine(), e.GetColumn(),
-        static_cast<uint32_t>(e.GetCode())
-    );
-    std::cerr << e.what() << std::endl;
+    if (!m_quiet) {
+        const auto [line, column] = lexer.Locate(e.GetOffset());
+        const unsigned endColumn = lexer.Locate(e.GetOffset() + e.GetLength()).column;
+
+        std::cerr << std::format(
+            "({}:{}) SE-{:04X}: ",
+            line, column,
+            static_cast<uint32_t>(e.GetCode())
+        );
+        std::cerr << e.GetMessage() << std::endl;
 
-    lexer.SkipLine();
-    PrintHint(lexer.GetCurrentLine(), e.GetColumn(), e.GetLength());
+        lexer.SkipLine();
+        PrintHint(lexer.GetCurrentLine(), column, endColumn - column);
+    }
 
     m_status = 2;
     throw CriticalLanguageException();
@@ -63,24 +82,28 @@ void ErrorManager::LogSemanticError(
     std::string_view currentLine,
     unsigned line, unsigned column,
     unsigned length,
-    SemanticError error,
-    std::string_view message
+    const SemanticDiagnostic& diagnostic
 ) {
+    m_status = 1;
+
+    if (m_quiet)
+        return;
+
     std::cerr << std::format(
         "({}:{}) UE-{:04X}: ",
         line, column,
-        static_cast<uint32_t>(error)
+        static_cast<uint32_t>(diagnostic.GetCode())
     );
-    std::cerr << message << std::endl;
+    std::cerr << diagnostic.GetMessage() << std::endl;
 
     if (length > 0) {
         PrintHint(currentLine, column, length);
     }
-
-    m_status = 1;
 }
 
 void ErrorManager::LogError(std::string_view message) {
     m_status = 1;
-    std::cerr << message << std::endl;
+
+    if (!m_quiet)
+        std::cerr << message << std::endl;
 }
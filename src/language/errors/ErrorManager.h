@@ -3,6 +3,10 @@
 #include "language/errors/LexicalError.h"
 #include "language/errors/SyntaxError.h"
 #include "language/errors/SemanticError.h"
+#include "language/core/LineIndex.h"
+
+#include <stdexcept>
+#include <string_view>
 
 class Lexer;
 class Parser;
@@ -20,20 +24,38 @@ class ErrorManager {
     LexicalRecoveryMode m_lexicalMode = LexicalRecoveryMode::SkipChar;
     int m_status = 0;
 
+    /** Si no se muestran los errores. Sólo cambia el estado, y los mensajes no llegan a formarse. **/
+    bool m_quiet = false;
+
 public:
     ErrorManager() = default;
 
+    explicit ErrorManager(const bool quiet) : m_quiet(quiet) {}
+
+    [[nodiscard]] bool IsQuiet() const { return m_quiet; }
+
     void SetLexicalRecoveryMode(LexicalRecoveryMode mode) { m_lexicalMode = mode; }
 
-    void ProcessLexicalException(Lexer& lexer, const LexicalException& e);
+    [[nodiscard]] LexicalRecoveryMode GetLexicalRecoveryMode() const { return m_lexicalMode; }
+
+    void ProcessLexicalError(Lexer& lexer, const LexicalDiagnostic& e);
+
+    /**
+     * Muestra un error léxico. Si el modo de recuperación es crítico, lanza
+     * CriticalLanguageException; si no, la recuperación queda a cargo del llamador.
+     * @param e El error.
+     * @param location La línea y la columna del error.
+     * @param currentLine La línea en la que se encuentra el analizador léxico.
+     */
+    void LogLexicalError(const LexicalDiagnostic& e, SourceLocation location, std::string_view currentLine);
+
     void ProcessSyntaxException(Lexer& lexer, const SyntaxException& e);
 
     void LogSemanticError(
         std::string_view currentLine,
         unsigned line, unsigned column,
         unsigned length,
-        SemanticError error,
-        std::string_view message
+        const SemanticDiagnostic& diagnostic
     );
 
     void LogError(std::string_view message);
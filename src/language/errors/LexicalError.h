@@ -2,8 +2,9 @@
 
 #include "language/core/Characters.h"
 
-#include <stdexcept>
+#include <cstddef>
 #include <format>
+#include <string>
 #include <utility>
 
 enum class LexicalError : uint32_t {
@@ -66,24 +67,28 @@ constexpr std::string GetErrorMessage(LexicalError error, char32_t invalidCharac
     std::unreachable();
 }
 
-class LexicalException final : public std::runtime_error {
+/**
+ * Un error léxico. El analizador los devuelve como valores en lugar de
+ * lanzarlos, ya que una entrada dañada puede producir millones de ellos.
+ */
+class LexicalDiagnostic {
+    size_t m_offset;
     LexicalError m_error;
-    unsigned m_lineNumber;
-    unsigned m_columnNumber;
+    char32_t m_invalidCharacter;
 
 public:
-     LexicalException(
-        const unsigned lineNumber,
-        const unsigned columnNumber,
-        LexicalError error,
-        char32_t invalidCharacter
+    constexpr LexicalDiagnostic(
+        const size_t offset,
+        const LexicalError error,
+        const char32_t invalidCharacter
     ) noexcept
-        : runtime_error(GetErrorMessage(error, invalidCharacter)),
+        : m_offset(offset),
           m_error(error),
-          m_lineNumber(lineNumber),
-          m_columnNumber(columnNumber) {}
+          m_invalidCharacter(invalidCharacter) {}
 
     [[nodiscard]] LexicalError GetCode() const { return m_error; }
-    [[nodiscard]] unsigned GetLine() const { return m_lineNumber; }
-    [[nodiscard]] unsigned GetColumn() const { return m_columnNumber; }
+    [[nodiscard]] size_t GetOffset() const { return m_offset; }
+
+    /** Forma el mensaje del error. **/
+    [[nodiscard]] std::string GetMessage() const { return GetErrorMessage(m_error, m_invalidCharacter); }
 };
@@ -1,5 +1,13 @@
 #pragma once
 
+#include "language/core/ValueProduct.h"
+
+#include <array>
+#include <format>
+#include <string>
+#include <string_view>
+#include <variant>
+
 enum class SemanticError : uint32_t {
     IDENTIFIER_ALREADY_EXISTS = 0x0000,
 
@@ -16,3 +24,49 @@ enum class SemanticError : uint32_t {
     INCOHERENT_FUNCTION_AS_VARIABLE_TYPES = 0x0202,
     INCOHERENT_CALL_PARAM_TYPES = 0x0203
 };
+
+/**
+ * Un error semántico, con el mensaje aún sin formar: el formato y sus
+ * argumentos (nombres o tipos) se guardan tal cual y el texto sólo se forma
+ * si se llega a mostrar. Los argumentos no se copian, por lo que deben seguir
+ * siendo válidos mientras se use el error.
+ */
+class SemanticDiagnostic {
+    static constexpr size_t MAX_ARGUMENTS = 3;
+
+    using Argument = std::variant<std::string_view, const ValueProduct*>;
+
+    SemanticError m_error;
+    std::string_view m_format;
+    std::array<Argument, MAX_ARGUMENTS> m_arguments;
+
+    static Argument ToArgument(const std::string_view name) { return name; }
+    static Argument ToArgument(const ValueProduct& type) { return &type; }
+
+public:
+    /**
+     * @param error El código del error.
+     * @param format El formato del mensaje, como el de std::format.
+     * @param arguments Los argumentos del mensaje: nombres o tipos.
+     */
+    template<typename... Args> requires (sizeof...(Args) <= MAX_ARGUMENTS)
+    SemanticDiagnostic(const SemanticError error, const std::string_view format, const Args&... arguments)
+        : m_error(error),
+          m_format(format),
+          m_arguments { ToArgument(arguments)... } {}
+
+    [[nodiscard]] SemanticError GetCode() const { return m_error; }
+
+    /** Forma el mensaje del error. **/
+    [[nodiscard]] std::string GetMessage() const {
+        std::array<std::string, MAX_ARGUMENTS> texts;
+        for (size_t i = 0; i < MAX_ARGUMENTS; i++) {
+            if (const auto* type = std::get_if<const ValueProduct*>(&m_arguments[i]))
+                texts[i] = (*type)->ToReadableString();
+            else
+                texts[i] = std::get<std::string_view>(m_arguments[i]);
+        }
+
+        return std::vformat(m_format, std::make_format_args(texts[0], texts[1], texts[2]));
+    }
+};
@@ -2,8 +2,9 @@
 
 #include "language/core/Token.h"
 
-#include <stdexcept>
+#include <exception>
 #include <format>
+#include <string>
 #include <utility>
 
 enum class SyntaxError : uint32_t {
@@ -245,31 +246,28 @@ constexpr std::string GetErrorMessage(SyntaxError error, const Token& token) {
     std::unreachable();
 }
 
-class SyntaxException final : public std::runtime_error {
+/**
+ * Un error sintáctico. Detiene el análisis, por lo que se lanza, pero el
+ * mensaje no se forma hasta que se muestra.
+ */
+class SyntaxException final : public std::exception {
     SyntaxError m_error;
     Token m_token;
 
 public:
-    [[deprecated]]
-    SyntaxException(
-        const unsigned lineNumber,
-        const unsigned columnNumber,
-        const std::string& message
-    ) noexcept
-        : runtime_error(message),
-          m_error(),
-          m_token(TokenType::END, lineNumber, columnNumber) {}
-
     SyntaxException(
         const SyntaxError error,
         const Token& token
     ) noexcept
-        : runtime_error(GetErrorMessage(error, token)),
-          m_error(error),
+        : m_error(error),
           m_token(token) {}
 
+    [[nodiscard]] const char* what() const noexcept override { return "Error sintáctico."; }
+
     [[nodiscard]] SyntaxError GetCode() const { return m_error; }
-    [[nodiscard]] unsigned GetLine() const { return m_token.line; }
-    [[nodiscard]] unsigned GetColumn() const { return m_token.column; }
+    [[nodiscard]] size_t GetOffset() const { return m_token.offset; }
     [[nodiscard]] unsigned GetLength() const { return m_token.length; }
+
+    /** Forma el mensaje del error. **/
+    [[nodiscard]] std::string GetMessage() const { return GetErrorMessage(m_error, m_token); }
 };
@@ -1,275 +1,434 @@
 #include "Lexer.h"
 
-void Lexer::ReadDelAndComments() {
-    while (true) {
-        // 0 : del : 0
-        if (IsSpaceAscii(m_lastChar)) {
-            Read();
-        }
-        // 0 : / : 15
-        else if (m_lastChar == '/') {
-            Read();
+#include "language/core/ByteScan.h"
 
-            // 15 : * : 16
-            if (m_lastChar != '*')
-                ThrowInstantLexicalError(LexicalError::MISSING_COMMENT_START);
+#include <thread>
+#include <utility>
 
-            Read();
+void Lexer::ReadNonAscii() {
+    if (m_cursor == m_end && !Refill()) {
+        m_lastCharStart = m_cursor;
+        m_lastChar = static_cast<char32_t>(EOF);
+        return;
+    }
 
-            // Procesamos el resto de transiciones como un bucle.
-            bool m_loop = true;
-            bool m_awaitExit = false;
-            while (m_loop) {
-                if (m_lastChar == EOF)
-                    ThrowInstantLexicalError(LexicalError::MISSING_COMMENT_END);
-
-                if (m_awaitExit) {
-                    // 17 : / : 0
-                    if (m_lastChar == '/') {
-                        Read();
-                        m_loop = false;
-                    }
-                    // 17 : * : 17
-                    else if (m_lastChar == '*') {
-                        Read();
-                    }
-                    // 17 : cc : 16
-                    else {
-                        m_awaitExit = false;
-                        Read();
-                    }
-                } else {
-                    if (m_lastChar == '*') {
-                        m_awaitExit = true;
-                        Read();
-                    } else {
-                        m_awaitExit = false;
-                        Read();
-                    }
-                }
-            }
-        }
+    m_lastCharStart = m_cursor;
+    m_lastChar = ReadSanitizedCodepoint(m_cursor);
 
-        // Otra transición. Salimos del bucle.
-        else break;
+#ifndef NDEBUG
+    if (m_lastChar == U'€') {
+        m_lastChar = static_cast<char32_t>(EOF);
+        return;
     }
+#endif
+
+    // Tras cargar un bloque nuevo, el carácter también puede ser ASCII.
+    if (const auto size = static_cast<size_t>(m_cursor - m_lastCharStart); size > 1)
+        m_lineIndex.AddWideCharacter(GetLastCharOffset(), size);
 }
 
-Token Lexer::ReadToken(GlobalState& globals) {
-    ReadDelAndComments();
+template<bool AsciiOnly>
+std::string_view Lexer::ReadIdentifier(std::string& spill) {
+    const char* start = m_lastCharStart;
 
-    m_tokenColumn = m_column;
+    do {
+        m_cursor = FindIdentifierEnd(m_cursor, m_end);
 
-    // 0 : l : 1
-    if (IsAlphaUnicode(m_lastChar)) {
-        std::string lex;
-        lex += static_cast<char>(m_lastChar);
+        // Al cargar el siguiente bloque se pierde el actual, así que se copia lo leído.
+        const bool blockEnded = m_cursor == m_end;
+        if (blockEnded)
+            spill.append(start, m_cursor);
 
         Read();
 
-        // 1 : l, d, _ : 1
-        while (IsAlnumUnicode(m_lastChar) || m_lastChar == '_') {
-            lex += static_cast<char>(m_lastChar);
-            Read();
-        }
+        if (blockEnded)
+            start = m_lastCharStart;
+    } while (LexerTable::IsIdentifierPart(LexerTable::GetCharClass<AsciiOnly>(m_lastChar)));
 
-        // 1 : oc : 2
-        const TokenType type = KeywordToToken(lex);
+    if (spill.empty())
+        return { start, m_lastCharStart };
 
-        if (type != TokenType::IDENTIFIER)
-            return CreateToken(type);
+    spill.append(start, m_lastCharStart);
+    return spill;
+}
 
-        auto pos = globals.SearchSymbol(lex);
+namespace {
+    /**
+     * Añade unos dígitos al valor de una constante entera.
+     * @param begin El primer dígito.
+     * @param end El final de los dígitos.
+     * @param num El valor hasta ahora, menor o igual que 32767.
+     * @return Si el valor sigue siendo menor o igual que 32767.
+     */
+    bool AccumulateDigits(const char* begin, const char* end, int32_t& num) {
+        // Los ceros a la izquierda no cambian el valor.
+        if (num == 0) {
+            while (begin != end && *begin == '0')
+                begin += 1;
+        }
 
-        if (!pos.has_value()) {
-            if (globals.implicitDeclaration) {
-                const auto newPos = globals.AddGlobalSymbol(lex);
-                globals.AddType(newPos, ValueProduct { tInt });
-                globals.AddOffset(newPos, globals.globalOffset);
-                globals.globalOffset += wInt;
-                pos = newPos;
-            } else {
-                pos = globals.AddSymbol(lex);
-            }
+        // Más de cinco dígitos significativos son siempre demasiados.
+        if (end - begin > 5)
+            return false;
+
+        for (; begin != end; begin++) {
+            num = num * 10 + (*begin - '0');
+            if (num > 32767)
+                return false;
         }
 
-        return CreateToken(type, pos.value());
+        return true;
     }
+}
+
+std::optional<int16_t> Lexer::ReadInteger() {
+    const char* start = m_lastCharStart;
+    int32_t num = 0;
+    bool fits = true;
+
+    do {
+        m_cursor = FindDigitEnd(m_cursor, m_end);
+
+        // Si el valor ya no cabe, el resto de dígitos sólo se consume.
+        fits = fits && AccumulateDigits(start, m_cursor, num);
 
-    // 0 : d : 3
-    if (IsDigitAscii(m_lastChar)) {
-        int32_t num = static_cast<unsigned char>(m_lastChar) - '0';
-        bool numberTooBig = false;
         Read();
+        start = m_lastCharStart;
+    } while (IsDigitAscii(m_lastChar));
 
-        // 3 : d : 3
-        while (IsDigitAscii(m_lastChar)) {
-            if (!numberTooBig) {
-                num = num * 10 + (static_cast<unsigned char>(m_lastChar) - '0');
+    if (!fits)
+        return std::nullopt;
 
-                if (num > 32767) {
-                    numberTooBig = true;
-                }
-            }
+    return static_cast<int16_t>(num);
+}
+
+template<bool AsciiOnly>
+std::expected<Token, LexicalDiagnostic> Lexer::ReadToken(GlobalState& globals) {
+    LexerState state = LexerState::START;
 
+    std::string spill;
+    std::string_view identifier;
+    std::optional<int16_t> integer;
+    size_t counter = 0;
+
+    while (true) {
+        // Mientras no se haya empezado un token, el token empieza en el carácter actual.
+        if (state == LexerState::START) {
+            m_tokenOffset = GetLastCharOffset();
+
+            // Al analizar por fragmentos, lo que sigue ya es del siguiente fragmento.
+            if (m_tokenOffset >= m_stopOffset)
+                return Token { .offset = m_tokenOffset, .payload = 0, .length = 0, .type = TokenType::END };
+        }
+
+        const LexerTransition& transition = LexerTable::GetTransition(state, LexerTable::GetCharClass<AsciiOnly>(m_lastChar));
+
+        switch (transition.action) {
+        case LexerAction::SKIP:
             Read();
+            break;
+
+        case LexerAction::SKIP_BLANKS:
+            SkipBytes(FindNonBlank);
+            break;
+
+        case LexerAction::SKIP_COMMENT:
+            SkipBytes(FindCommentStop);
+            break;
+
+        case LexerAction::READ_IDENTIFIER:
+            identifier = ReadIdentifier<AsciiOnly>(spill);
+            break;
+
+        case LexerAction::END_IDENTIFIER: {
+            const TokenType type = KeywordToToken(identifier);
+
+            if (type != TokenType::IDENTIFIER)
+                return CreateToken(type);
+
+            const InternId name = globals.interner.Intern(identifier);
+            if (!m_resolveSymbols)
+                return CreateToken(type, name);
+
+            return CreateToken(type, Token::EncodeSymbol(globals.ResolveIdentifier(name)));
         }
 
-        // 3 : oc : 4
-        if (numberTooBig)
-            ThrowInstantLexicalError(LexicalError::INT_TOO_BIG, true);
+        case LexerAction::READ_INTEGER:
+            integer = ReadInteger();
+            break;
 
-        return CreateToken(TokenType::CINT, static_cast<int16_t>(num));
-    }
+        case LexerAction::END_INTEGER:
+            if (!integer.has_value())
+                return InstantLexicalError(LexicalError::INT_TOO_BIG, true);
 
-    // 0 : ' : 5
-    if (m_lastChar == '\'') {
-        std::string str;
-        size_t counter = 0;
-        Read();
+            return CreateToken(TokenType::CINT, Token::EncodeInteger(integer.value()));
 
-        while (m_lastChar != '\'') {
-            if (m_lastChar == static_cast<char32_t>(EOF))
-                ThrowInstantLexicalError(LexicalError::MISSING_STRING_END);
+        case LexerAction::START_STRING:
+            globals.literals.Start();
+            Read();
+            break;
 
-            // 5 : \ : 6
-            if (m_lastChar == '\\') {
-                Read();
+        case LexerAction::APPEND_STRING: {
+            // Los bytes del carácter se copian tal cual: la entrada ya está saneada.
+            // Con él se copian también los caracteres ASCII que no necesitan tratamiento.
+            const char* runEnd = FindStringStop(m_cursor, m_end);
+            globals.literals.Append({ m_lastCharStart, runEnd });
+            counter += 1 + (runEnd - m_cursor);
 
-                // 6 : cesc : 5
-                const int escapedChar = EscapedToAscii(m_lastChar);
+            m_cursor = runEnd;
+            Read();
+            break;
+        }
 
-                // Carácter ilegal.
-                if (escapedChar == -1)
-                    ThrowLexicalError(LexicalError::STRING_ESCAPE_SEQUENCE);
+        case LexerAction::APPEND_ESCAPED: {
+            const int escapedChar = EscapedToAscii(m_lastChar);
 
-                str += CodepointToUtf8(escapedChar);
-                counter += 1;
-                Read();
-            }
-            // 5 : oc : 5
-            else if (!IsAscii(m_lastChar) || IsPrintAscii(m_lastChar) || m_lastChar == ' ') {
-                str += CodepointToUtf8(m_lastChar);
-                counter += 1;
-                Read();
-            }
             // Carácter ilegal.
-            else {
-                ThrowLexicalError(LexicalError::STRING_FORBIDDEN_CHARACTER);
-            }
+            if (escapedChar == -1)
+                return LexicalErrorRead(LexicalError::STRING_ESCAPE_SEQUENCE);
+
+            globals.literals.Append(static_cast<char>(escapedChar));
+            counter += 1;
+            Read();
+            break;
         }
 
-        // 5 : ' : 7
+        case LexerAction::END_STRING:
+            // Comprobamos el contador y, si es mayor que 64, lanzamos un error.
+            if (counter > 64)
+                return LexicalErrorRead(LexicalError::STRING_TOO_LONG, true);
 
-        // Comprobamos el contador y, si es mayor que 64, lanzamos un error.
-        if (counter > 64)
-            ThrowLexicalError(LexicalError::STRING_TOO_LONG, true);
+            Read();
+            return CreateToken(TokenType::CSTR, globals.literals.Finish());
 
-        Read();
-        return CreateToken(TokenType::CSTR, str);
-    }
+        case LexerAction::EMIT_READ:
+            Read();
+            return CreateToken(transition.token);
 
-    // 0 : + : 8
-    if (m_lastChar == '+') {
-        Read();
+        case LexerAction::EMIT:
+            return CreateToken(transition.token);
 
-        // 8 : oc : 9
-        if (m_lastChar != '=')
-            return CreateToken(TokenType::SUM);
+        case LexerAction::END_OF_FILE:
+            // El fin de fichero no ocupa ningún byte, pero se muestra como un carácter.
+            return Token { .offset = m_tokenOffset, .payload = 0, .length = 1, .type = TokenType::END };
 
-        // 8 : = : 9
-        Read();
-        return CreateToken(TokenType::CUMULATIVE_ASSIGN);
-    }
+        case LexerAction::ERROR_INSTANT:
+            return InstantLexicalError(transition.error);
 
-    // 0 : - : 10
-    if (m_lastChar == '-') {
-        Read();
-        return CreateToken(TokenType::SUB);
-    }
+        case LexerAction::ERROR_READ:
+            return LexicalErrorRead(transition.error);
+        }
 
-    // 0 : = : 10
-    if (m_lastChar == '=') {
-        Read();
-        return CreateToken(TokenType::ASSIGN);
+        state = transition.next;
     }
+}
 
-    // 0 : < : 10
-    if (m_lastChar == '<') {
-        Read();
-        return CreateToken(TokenType::LESS);
-    }
+template std::expected<Token, LexicalDiagnostic> Lexer::ReadToken<false>(GlobalState& globals);
+template std::expected<Token, LexicalDiagnostic> Lexer::ReadToken<true>(GlobalState& globals);
 
-    // 0 : > : 10
-    if (m_lastChar == '>') {
-        Read();
-        return CreateToken(TokenType::GREATER);
-    }
+Lexer::LexedChunk Lexer::LexChunk(
+    const std::string_view contents,
+    const size_t start, const size_t stop,
+    const LexerOptions& options,
+    const LexicalRecoveryMode mode
+) {
+    LexedChunk chunk { .start = start };
 
-    // 0 : & : 11
-    if (m_lastChar == '&') {
-        Read();
+    Source source = Source::FromSanitizedBytes(contents.substr(start));
+    Lexer lexer(source, start, stop);
+    lexer.m_resolveSymbols = false;
 
-        // 11 : & : 12
-        if (m_lastChar != '&')
-            ThrowInstantLexicalError(LexicalError::MISSING_OP_AND);
+    size_t consecutiveErrors = 0;
 
-        Read();
-        return CreateToken(TokenType::AND);
-    }
+    while (true) {
+        const auto result = options.asciiOnly ? lexer.ReadToken<true>(chunk.globals) : lexer.ReadToken<false>(chunk.globals);
 
-    // 0 : | : 13
-    if (m_lastChar == '|') {
-        Read();
-        if (m_lastChar != '|')
-            ThrowInstantLexicalError(LexicalError::MISSING_OP_OR);
+        if (result.has_value()) {
+            const Token& token = result.value();
+            consecutiveErrors = 0;
 
-        Read();
-        return CreateToken(TokenType::OR);
-    }
+            if (token.type == TokenType::END && token.offset >= stop) {
+                chunk.resume = token.offset;
+                break;
+            }
 
-    // 0 : , : 18
-    if (m_lastChar == ',') {
-        Read();
-        return CreateToken(TokenType::COMMA);
-    }
+            chunk.tokens.Append(token);
 
-    // 0 : ; : 18
-    if (m_lastChar == ';') {
-        Read();
-        return CreateToken(TokenType::SEMICOLON);
+            if (token.type == TokenType::END) {
+                chunk.resume = token.offset;
+                break;
+            }
+
+            continue;
+        }
+
+        const size_t lineEnd = lexer.GetOffset(lexer.m_cursor) - (lexer.m_lastChar == U'\n' ? 1 : 0);
+        chunk.errors.push_back({
+            .tokenIndex = chunk.tokens.GetCount(),
+            .diagnostic = result.error(),
+            .lineOffset = lexer.GetLastCharOffset(),
+            .lineEnd = lineEnd
+        });
+
+        // Como en GetToken. Al unir los fragmentos se vuelven a contar los errores seguidos.
+        consecutiveErrors += 1;
+        if (mode == LexicalRecoveryMode::Critical || consecutiveErrors == MAX_CONSECUTIVE_ERRORS)
+            break;
+
+        if (mode == LexicalRecoveryMode::SkipLine)
+            lexer.SkipLine();
     }
 
-    // 0 : ( : 18
-    if (m_lastChar == '(') {
-        Read();
-        return CreateToken(TokenType::PARENTHESIS_OPEN);
+    chunk.lineIndex = std::move(lexer.m_lineIndex);
+    return chunk;
+}
+
+void Lexer::Pretokenize(GlobalState& globals) {
+    m_source.LoadAll();
+    const std::string_view contents = m_source.GetContents();
+
+    const LexerOptions& options = globals.lexerOptions;
+    const LexicalRecoveryMode mode = globals.errorManager.GetLexicalRecoveryMode();
+
+    // Los fragmentos empiezan tras un salto de línea, donde casi nunca hay un token a medias.
+    const size_t threads = options.threads != 0 ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+    const size_t chunkSize = std::max(contents.size() / threads, MIN_CHUNK_SIZE);
+
+    std::vector<size_t> starts { 0 };
+    while (contents.size() - starts.back() > chunkSize) {
+        const size_t newLine = contents.find('\n', starts.back() + chunkSize);
+        if (newLine == std::string_view::npos || newLine + 1 == contents.size())
+            break;
+
+        starts.push_back(newLine + 1);
     }
 
-    // 0 : ) : 18
-    if (m_lastChar == ')') {
-        Read();
-        return CreateToken(TokenType::PARENTHESIS_CLOSE);
+    const auto GetStop = [&](const size_t i) {
+        return i + 1 < starts.size() ? starts[i + 1] : SIZE_MAX;
+    };
+
+    std::vector<LexedChunk> chunks(starts.size());
+    {
+        std::vector<std::jthread> workers;
+        for (size_t i = 1; i < starts.size(); i++) {
+            workers.emplace_back([&, i] {
+                chunks[i] = LexChunk(contents, starts[i], GetStop(i), options, mode);
+            });
+        }
+
+        chunks[0] = LexChunk(contents, 0, GetStop(0), options, mode);
     }
 
-    // 0 : { : 18
-    if (m_lastChar == '{') {
-        Read();
-        return CreateToken(TokenType::CURLY_BRACKET_OPEN);
+    // Se unen los fragmentos en orden. Si uno no ha empezado donde termina
+    // el anterior, se vuelve a analizar desde allí.
+    TokenBuffer tokens;
+    size_t consecutiveErrors = 0;
+
+    for (size_t i = 0; i < chunks.size(); i++) {
+        LexedChunk& chunk = chunks[i];
+        if (i > 0) {
+            const std::optional<size_t> previousEnd = chunks[i - 1].resume;
+            if (previousEnd != chunk.start)
+                chunk = LexChunk(contents, previousEnd.value(), GetStop(i), options, mode);
+        }
+
+        const size_t firstToken = tokens.GetCount();
+        const size_t end = chunk.resume.value_or(contents.size());
+        m_lineIndex.Append(chunk.lineIndex, chunk.start, std::min(end, contents.size()));
+
+        for (PendingLexicalError& error : chunk.errors) {
+            error.tokenIndex += firstToken;
+
+            consecutiveErrors = !m_lexicalErrors.empty() && m_lexicalErrors.back().tokenIndex == error.tokenIndex
+                                    ? consecutiveErrors + 1
+                                    : 1;
+            m_lexicalErrors.push_back(std::move(error));
+
+            if (mode == LexicalRecoveryMode::Critical || consecutiveErrors == MAX_CONSECUTIVE_ERRORS) {
+                m_criticalToken = m_lexicalErrors.back().tokenIndex;
+                break;
+            }
+        }
+
+        // Los nombres y las cadenas del fragmento pasan a los comunes.
+        std::vector<InternId> names(chunk.globals.interner.GetCount());
+        for (InternId id = 0; id < names.size(); id++)
+            names[id] = globals.interner.Intern(chunk.globals.interner.GetName(id));
+
+        const uint32_t firstLiteral = globals.literals.GetCount();
+        for (uint32_t index = 0; index < chunk.globals.literals.GetCount(); index++) {
+            globals.literals.Start();
+            globals.literals.Append(chunk.globals.literals.Get(index));
+            globals.literals.Finish();
+        }
+
+        const size_t tokenCount = m_criticalToken.has_value()
+                                      ? m_criticalToken.value() - firstToken
+                                      : chunk.tokens.GetCount();
+
+        for (size_t index = 0; index < tokenCount; index++) {
+            Token token = chunk.tokens.Get(index);
+            if (token.type == TokenType::IDENTIFIER)
+                token.payload = names[token.payload];
+            else if (token.type == TokenType::CSTR)
+                token.payload += firstLiteral;
+
+            tokens.Append(token);
+        }
+
+        if (m_criticalToken.has_value())
+            break;
     }
 
-    // 0 : } : 18
-    if (m_lastChar == '}') {
-        Read();
-        return CreateToken(TokenType::CURLY_BRACKET_CLOSE);
+    m_tokens = std::move(tokens);
+}
+
+Token Lexer::GetBufferedToken(GlobalState& globals) {
+    while (m_nextLexicalError < m_lexicalErrors.size()
+           && m_lexicalErrors[m_nextLexicalError].tokenIndex == m_nextToken) {
+        const PendingLexicalError& error = m_lexicalErrors[m_nextLexicalError++];
+        globals.errorManager.LogLexicalError(
+            error.diagnostic,
+            Locate(error.diagnostic.GetOffset()),
+            GetLine(error.lineOffset, error.lineEnd)
+        );
     }
 
-    // 0 : eof : 19
-    if (m_lastChar == EOF) {
-        m_column += 1;
-        return CreateToken(TokenType::END);
+    if (m_criticalToken == m_nextToken)
+        throw CriticalLanguageException();
+
+    // Tras el fin de fichero, se vuelve a entregar el mismo token.
+    Token token = m_tokens->Get(m_nextToken);
+    if (token.type != TokenType::END)
+        m_nextToken += 1;
+
+    if (token.type == TokenType::IDENTIFIER)
+        token.payload = Token::EncodeSymbol(globals.ResolveIdentifier(token.payload));
+
+    m_deliveredEnd = token.type == TokenType::END ? token.offset : token.offset + token.length;
+    m_lineSkipped = false;
+
+    return token;
+}
+
+std::string_view Lexer::GetLine(const size_t offset, const size_t end) const {
+    const size_t start = m_lineIndex.GetLineStart(offset);
+    return m_source.GetContents().substr(start, end - start);
+}
+
+std::string_view Lexer::GetBufferedLine() const {
+    const std::string_view contents = m_source.GetContents();
+
+    // Como en la lectura normal, la línea llega hasta el carácter que sigue
+    // al token, o hasta su final si se ha saltado. El salto no se incluye.
+    size_t end = contents.size();
+    if (m_lineSkipped) {
+        end = std::min(contents.find('\n', m_deliveredEnd), contents.size());
+    } else if (m_deliveredEnd < contents.size()) {
+        const char* cursor = contents.data() + m_deliveredEnd;
+        const char32_t c = ReadSanitizedCodepoint(cursor);
+        end = cursor - contents.data() - (c == U'\n' ? 1 : 0);
     }
 
-    // Carácter desconocido.
-    ThrowLexicalError(LexicalError::UNEXPECTED_START_CHARACTER);
+    return GetLine(m_deliveredEnd, end);
 }
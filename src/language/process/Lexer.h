@@ -3,107 +3,329 @@
 #include "language/core/Token.h"
 #include "language/errors/LexicalError.h"
 #include "language/core/GlobalState.h"
+#include "language/core/Source.h"
+#include "language/core/LineIndex.h"
+#include "language/process/LexerTable.h"
+#include "language/process/TokenBuffer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <expected>
+#include <optional>
+#include <string_view>
+#include <vector>
 
 class Lexer {
-    std::istream& m_input;
+    /** El número de errores seguidos tras el que se abandona el análisis. **/
+    static constexpr size_t MAX_CONSECUTIVE_ERRORS = 5000;
+
+    /** El tamaño mínimo de los fragmentos que se analizan en paralelo. **/
+    static constexpr size_t MIN_CHUNK_SIZE = 1024 * 1024;
+
+    /** Un error encontrado al analizar la entrada por adelantado, pendiente de mostrar. **/
+    struct PendingLexicalError {
+        /** El índice del token que se estaba leyendo. El error se muestra al pedirlo. **/
+        size_t tokenIndex;
+        LexicalDiagnostic diagnostic;
+
+        // La línea actual al encontrar el error: la del último carácter leído, hasta este final.
+        size_t lineOffset;
+        size_t lineEnd;
+    };
+
+    /** Los tokens de un fragmento de la entrada, analizado por separado. **/
+    struct LexedChunk {
+        /** La posición en la que empieza el análisis, fuera de cualquier token. **/
+        size_t start;
+
+        /**
+         * La primera posición fuera de cualquier token a partir del final del
+         * fragmento, donde debe empezar el siguiente. Vacío si el análisis se
+         * ha abandonado por los errores.
+         */
+        std::optional<size_t> resume;
+
+        TokenBuffer tokens;
+        std::vector<PendingLexicalError> errors;
+
+        // Los nombres de los identificadores y las cadenas son propios del fragmento.
+        GlobalState globals;
+        LineIndex lineIndex;
+    };
+
+    Source& m_source;
+    const char* m_begin = nullptr;
+    const char* m_cursor = nullptr;
+    const char* m_end = nullptr;
+
+    /** La posición en la entrada del inicio del bloque actual. **/
+    size_t m_beginOffset = 0;
+
     char32_t m_lastChar = U' ';
+    const char* m_lastCharStart = nullptr;
+
+    const char* m_lineStart = nullptr;
+
+    bool m_newLine = false;
+
+    LineIndex m_lineIndex;
 
-    std::basic_string<char32_t> m_currentLine;
+    /** La primera posición que el usuario del analizador aún puede localizar (véase KeepLocatable). **/
+    size_t m_locatableOffset = SIZE_MAX;
 
-    bool m_newLine = true;
+    size_t m_tokenOffset = 0;
 
-    unsigned m_line = 0;
-    unsigned m_column = 0;
+    /** La posición a partir de la cual no se empiezan más tokens (véase LexChunk). **/
+    size_t m_stopOffset = SIZE_MAX;
 
-    unsigned m_tokenColumn = 0;
+    /** Si los identificadores se buscan en las tablas al leerlos o se deja su nombre internado. **/
+    bool m_resolveSymbols = true;
 
-    [[noreturn]]
-    void ThrowInstantLexicalError(LexicalError error, bool useToken = false) const {
-        throw LexicalException(m_line, useToken ? m_tokenColumn : m_column, error, m_lastChar);
+    // Con LexerOptions::pretokenize, los tokens se leen todos a la vez y se
+    // entregan desde aquí. Los errores se muestran al llegar a su token.
+    std::optional<TokenBuffer> m_tokens;
+    size_t m_nextToken = 0;
+    std::vector<PendingLexicalError> m_lexicalErrors;
+    size_t m_nextLexicalError = 0;
+    std::optional<size_t> m_criticalToken;
+
+    /** El final del último token entregado, que hace las veces de último carácter leído. **/
+    size_t m_deliveredEnd = 0;
+    bool m_lineSkipped = false;
+
+    /** Obtiene la posición en la entrada de un byte del bloque actual. **/
+    [[nodiscard]] size_t GetOffset(const char* position) const {
+        return m_beginOffset + (position - m_begin);
+    }
+
+    /** Obtiene la posición en la entrada del último carácter leído. **/
+    [[nodiscard]] size_t GetLastCharOffset() const {
+        return GetOffset(m_lastCharStart);
     }
 
-    [[noreturn]]
-    void ThrowLexicalError(LexicalError error, bool useToken = false) {
-        const unsigned line = m_line;
-        const unsigned column = useToken ? m_tokenColumn : m_column;
+    /** Crea un error en el carácter actual (o en el token), sin consumirlo. **/
+    [[nodiscard]] std::unexpected<LexicalDiagnostic> InstantLexicalError(LexicalError error, bool useToken = false) const {
+        return std::unexpected(LexicalDiagnostic(useToken ? m_tokenOffset : GetLastCharOffset(), error, m_lastChar));
+    }
+
+    /** Crea un error en el carácter actual (o en el token) y consume el carácter. **/
+    [[nodiscard]] std::unexpected<LexicalDiagnostic> LexicalErrorRead(LexicalError error, bool useToken = false) {
+        const size_t offset = useToken ? m_tokenOffset : GetLastCharOffset();
         const char32_t c = m_lastChar;
 
         Read();
-        throw LexicalException(line, column, error, c);
+        return std::unexpected(LexicalDiagnostic(offset, error, c));
     }
 
-    template<typename T>
-    constexpr Token CreateToken(TokenType tokenType, T&& attribute) {
-        assert(m_column > m_tokenColumn);
+    Token CreateToken(TokenType tokenType, uint32_t payload = 0) const {
+        const size_t endOffset = GetLastCharOffset();
+        assert(endOffset > m_tokenOffset);
         return Token {
-            .type = tokenType,
-            .line = m_line,
-            .column = m_tokenColumn,
-            .length = m_column - m_tokenColumn,
-            .attribute = attribute
+            .offset = m_tokenOffset,
+            .payload = payload,
+            .length = static_cast<uint32_t>(std::min<size_t>(endOffset - m_tokenOffset, Token::MAX_LENGTH)),
+            .type = tokenType
         };
     }
 
-    constexpr Token CreateToken(TokenType tokenType) {
-        return CreateToken(tokenType, std::monostate());
-    }
-
     void Read() {
         if (m_newLine) {
-            m_column = 0;
-            m_line += 1;
-            m_currentLine.clear();
+            m_lineStart = m_cursor;
+            m_lineIndex.AddLine(GetOffset(m_cursor));
             m_newLine = false;
         }
 
-        m_lastChar = ReadUtf8Codepoint(m_input);
-        m_column += 1;
+        m_lastCharStart = m_cursor;
 
-        if (m_lastChar == '\n') {
-            m_newLine = true;
+        // Camino rápido: un carácter ASCII es directamente su punto de código.
+        if (m_cursor != m_end && IsAscii(static_cast<unsigned char>(*m_cursor))) {
+            m_lastChar = static_cast<unsigned char>(*m_cursor);
+            m_cursor += 1;
         } else {
-            m_currentLine += m_lastChar;
+            ReadNonAscii();
         }
 
-#ifndef NDEBUG
-        if (m_lastChar == U'€') {
-            m_lastChar = static_cast<char32_t>(EOF);
+        if (m_lastChar == '\n') {
+            m_newLine = true;
         }
-#endif
     }
 
-    void ReadDelAndComments();
+    void ReadNonAscii();
 
-    Token ReadToken(GlobalState& globals);
+    /**
+     * Salta los bytes que siguen al carácter actual hasta el primero que
+     * encuentre la búsqueda y lo lee. Los bytes saltados deben ser ASCII y
+     * no contener saltos de línea, para no perder la cuenta de líneas y columnas.
+     * @param find La búsqueda del primer byte que no se puede saltar.
+     */
+    void SkipBytes(const char* (*find)(const char*, const char*)) {
+        // Tras un salto de línea, el siguiente carácter inicia la línea.
+        if (!m_newLine)
+            m_cursor = find(m_cursor, m_end);
+
+        Read();
+    }
+
+    /**
+     * Lee un identificador completo a partir de su primer carácter, que debe
+     * ser el actual. Los caracteres ASCII se recorren por bloques y sólo los
+     * demás se clasifican uno a uno con sus propiedades Unicode.
+     * @param spill Donde se copia el identificador si ocupa más de un bloque.
+     * @return Los bytes del identificador en la entrada (o en spill), válidos
+     *         hasta la siguiente lectura.
+     */
+    template<bool AsciiOnly>
+    std::string_view ReadIdentifier(std::string& spill);
+
+    /**
+     * Lee los dígitos de una constante entera a partir del primero, que debe
+     * ser el actual. Los dígitos se recorren por bloques.
+     * @return El valor de la constante, o vacío si es mayor que 32767.
+     */
+    std::optional<int16_t> ReadInteger();
+
+    /**
+     * Obtiene el siguiente bloque de la entrada, conservando la línea actual
+     * para poder mostrarla en los errores. De una línea muy larga, sólo se
+     * conserva el final.
+     */
+    bool Refill() {
+        const auto kept = std::min(static_cast<size_t>(m_end - m_lineStart), Source::MAX_KEPT_SIZE);
+        const std::string_view block = m_source.Refill(kept);
+
+        m_beginOffset = GetOffset(m_end) - kept;
+        m_begin = block.data();
+        m_lineStart = block.data();
+        m_cursor = block.data() + kept;
+        m_end = block.data() + block.size();
+
+        // Al leer por bloques, se olvidan las líneas que ya no se pueden
+        // localizar: las anteriores al bloque, al token que se está leyendo
+        // y a lo que el usuario necesita. La entrada en memoria se conserva.
+        if (!m_source.IsMapped())
+            m_lineIndex.Forget(std::min({ m_beginOffset, m_tokenOffset, m_locatableOffset }));
+
+        return m_cursor != m_end;
+    }
+
+    /**
+     * Lee el siguiente token de la entrada.
+     * @tparam AsciiOnly Si sólo se admiten caracteres ASCII fuera de las
+     *                   cadenas. El resto se tratan como caracteres inesperados,
+     *                   sin consultar sus propiedades Unicode.
+     * @return El token, o el error encontrado. Tras un error, se puede seguir leyendo.
+     */
+    template<bool AsciiOnly>
+    std::expected<Token, LexicalDiagnostic> ReadToken(GlobalState& globals);
+
+    /** Crea un analizador para un fragmento de la entrada (véase LexChunk). **/
+    Lexer(Source& source, const size_t startOffset, const size_t stopOffset)
+        : m_source(source), m_beginOffset(startOffset), m_stopOffset(stopOffset) {}
+
+    /**
+     * Analiza un fragmento de una entrada en memoria. El análisis empieza en
+     * una posición que se supone fuera de cualquier token y termina en la
+     * primera posición fuera de un token a partir del final, por lo que el
+     * último token puede acabar más allá.
+     * @param contents La entrada completa.
+     * @param start La posición en la que empezar.
+     * @param stop El final del fragmento.
+     * @param options Las opciones del analizador.
+     * @param mode El modo de recuperación de errores.
+     */
+    static LexedChunk LexChunk(
+        std::string_view contents,
+        size_t start, size_t stop,
+        const LexerOptions& options,
+        LexicalRecoveryMode mode
+    );
+
+    /**
+     * Lee la entrada completa y guarda sus tokens y sus errores para
+     * entregarlos después uno a uno. Los identificadores se guardan con su
+     * nombre internado: sus símbolos se buscan al entregarlos, cuando las
+     * tablas están como si se hubieran leído en ese momento.
+     *
+     * Una entrada grande se divide en fragmentos por los saltos de línea,
+     * que se analizan en paralelo suponiendo que ninguno empieza dentro de
+     * un token (p. ej., de un comentario). Al unirlos se comprueba dónde
+     * termina realmente cada uno, y sólo se vuelve a analizar el siguiente
+     * si la suposición era incorrecta.
+     */
+    void Pretokenize(GlobalState& globals);
+
+    /** Obtiene una línea de la entrada en memoria, desde su inicio hasta una posición. **/
+    [[nodiscard]] std::string_view GetLine(size_t offset, size_t end) const;
+
+    /** Entrega el siguiente token guardado, mostrando antes sus errores. **/
+    Token GetBufferedToken(GlobalState& globals);
+
+    /** Obtiene la línea actual a partir del último token entregado. **/
+    [[nodiscard]] std::string_view GetBufferedLine() const;
 
 public:
-    explicit Lexer(std::istream& input) : m_input(input) {}
+    explicit Lexer(Source& source) : m_source(source) {}
 
     Token GetToken(GlobalState& globals) {
-        for (size_t i = 0; i < 5000; i++) {
-            try {
-                return ReadToken(globals);
-            } catch (const LexicalException& e) {
-                globals.errorManager.ProcessLexicalException(*this, e);
-            }
+        if (globals.lexerOptions.pretokenize && !m_tokens.has_value())
+            Pretokenize(globals);
+
+        if (m_tokens.has_value())
+            return GetBufferedToken(globals);
+
+        for (size_t i = 0; i < MAX_CONSECUTIVE_ERRORS; i++) {
+            const auto result = globals.lexerOptions.asciiOnly ? ReadToken<true>(globals) : ReadToken<false>(globals);
+            if (result.has_value())
+                return result.value();
+
+            globals.errorManager.ProcessLexicalError(*this, result.error());
         }
 
         throw CriticalLanguageException();
     }
 
     void SkipLine() {
+        // Con los tokens ya leídos, sólo cambia la línea que se muestra.
+        if (m_tokens.has_value()) {
+            m_lineSkipped = true;
+            return;
+        }
+
         while (m_lastChar != U'\n' && m_lastChar != EOF) {
             Read();
         }
     }
 
-    std::string GetCurrentLine() const {
-        std::string result;
+    /**
+     * Indica la primera posición de la entrada que aún se puede localizar,
+     * como el inicio de las reglas en curso del analizador sintáctico. Al
+     * leer por bloques, se olvidan las líneas anteriores. Sin llamarla,
+     * sólo se pueden localizar los tokens de la línea actual.
+     * @param offset La posición. Nunca debe retroceder.
+     */
+    void KeepLocatable(const size_t offset) {
+        assert(m_locatableOffset == SIZE_MAX || offset >= m_locatableOffset);
+        m_locatableOffset = offset;
+    }
 
-        for (const char32_t& c : m_currentLine) {
-            result += CodepointToUtf8(c);
-        }
+    /**
+     * Obtiene la línea y la columna de una posición de la entrada.
+     * @param offset La posición en bytes, como la de un token. Debe ser
+     *               localizable (véase KeepLocatable).
+     */
+    [[nodiscard]] SourceLocation Locate(const size_t offset) const {
+        return m_lineIndex.Locate(offset);
+    }
+
+    /** Obtiene la línea actual, hasta el último carácter leído. **/
+    [[nodiscard]] std::string_view GetCurrentLine() const {
+        if (m_tokens.has_value())
+            return GetBufferedLine();
+
+        std::string_view line(m_lineStart, m_cursor - m_lineStart);
+        if (m_lastChar == '\n')
+            line.remove_suffix(1);
 
-        return result;
+        return line;
     }
 };
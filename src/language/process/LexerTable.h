@@ -0,0 +1,307 @@
+#pragma once
+
+#include "language/core/Characters.h"
+#include "language/core/Token.h"
+#include "language/errors/LexicalError.h"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+
+/*
+ * Tablas del autómata del analizador léxico (Memoria/1.3.AFD.tex). Cada
+ * carácter se reduce a una clase y cada par (estado, clase) tiene una única
+ * transición, con la acción semántica a realizar (Memoria/1.4.AccSemanticas.tex).
+ * Los estados finales no aparecen: las acciones que llevan a ellos generan
+ * directamente el token.
+ */
+
+/** Las clases de caracteres que distingue el autómata. **/
+enum class CharClass : uint8_t {
+    END_OF_FILE,
+    /** El espacio, el único delimitador que se admite en las cadenas. **/
+    SPACE,
+    /** El resto de delimitadores (tabulaciones y saltos de línea). **/
+    BLANK,
+    /** Los caracteres ASCII no imprimibles que no son delimitadores. **/
+    CONTROL,
+    /** Las letras, ASCII o no. **/
+    LETTER,
+    DIGIT,
+    /** Los dígitos no ASCII, que pueden continuar un identificador pero no iniciarlo. **/
+    OTHER_ALNUM,
+    UNDERSCORE,
+    QUOTE,
+    BACKSLASH,
+    PLUS,
+    MINUS,
+    EQUAL,
+    LESS,
+    GREATER,
+    AMPERSAND,
+    PIPE,
+    SLASH,
+    STAR,
+    COMMA,
+    SEMICOLON,
+    PARENTHESIS_OPEN,
+    PARENTHESIS_CLOSE,
+    CURLY_BRACKET_OPEN,
+    CURLY_BRACKET_CLOSE,
+    /** El resto de caracteres imprimibles, ASCII o no. **/
+    OTHER,
+
+    COUNT
+};
+
+/** Los estados no finales del autómata. **/
+enum class LexerState : uint8_t {
+    START,          // 0
+    IDENTIFIER,     // 1
+    INTEGER,        // 3
+    STRING,         // 5
+    STRING_ESCAPE,  // 6
+    PLUS,           // 8
+    AMPERSAND,      // 11
+    PIPE,           // 13
+    COMMENT_START,  // 15
+    COMMENT,        // 16
+    COMMENT_END,    // 17
+
+    COUNT
+};
+
+/** Las acciones semánticas de las transiciones. **/
+enum class LexerAction : uint8_t {
+    /** Lee el siguiente carácter. **/
+    SKIP,
+    /** Lee el siguiente carácter, saltando antes los delimitadores que siguen al actual. **/
+    SKIP_BLANKS,
+    /** Lee el siguiente carácter, saltando antes el texto del comentario que sigue al actual. **/
+    SKIP_COMMENT,
+
+    /** Lee el identificador completo (véase Lexer::ReadIdentifier). **/
+    READ_IDENTIFIER,
+    END_IDENTIFIER,
+
+    /** Lee la constante entera completa (véase Lexer::ReadInteger). **/
+    READ_INTEGER,
+    END_INTEGER,
+
+    START_STRING,
+    APPEND_STRING,
+    APPEND_ESCAPED,
+    END_STRING,
+
+    /** Lee el siguiente carácter y genera el token de la transición. **/
+    EMIT_READ,
+    /** Genera el token de la transición sin leer (transición con «o.c.»). **/
+    EMIT,
+    END_OF_FILE,
+
+    /** Error en el carácter actual, sin consumirlo. **/
+    ERROR_INSTANT,
+    /** Error en el carácter actual, que se consume. **/
+    ERROR_READ
+};
+
+struct LexerTransition {
+    LexerState next = LexerState::START;
+    LexerAction action = LexerAction::SKIP;
+    TokenType token = TokenType::END;
+    LexicalError error = LexicalError::UNEXPECTED_START_CHARACTER;
+};
+
+namespace LexerTable {
+    constexpr size_t CLASS_COUNT = std::to_underlying(CharClass::COUNT);
+    constexpr size_t STATE_COUNT = std::to_underlying(LexerState::COUNT);
+
+    constexpr std::array<CharClass, 128> ASCII_CLASSES = [] {
+        std::array<CharClass, 128> classes {};
+
+        for (size_t c = 0; c < classes.size(); c++) {
+            if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
+                classes[c] = CharClass::LETTER;
+            else if (c >= '0' && c <= '9')
+                classes[c] = CharClass::DIGIT;
+            else if (c >= '\t' && c <= '\r')
+                classes[c] = CharClass::BLANK;
+            else if (c < ' ' || c == 0x7F)
+                classes[c] = CharClass::CONTROL;
+            else
+                classes[c] = CharClass::OTHER;
+        }
+
+        classes[' '] = CharClass::SPACE;
+        classes['_'] = CharClass::UNDERSCORE;
+        classes['\''] = CharClass::QUOTE;
+        classes['\\'] = CharClass::BACKSLASH;
+        classes['+'] = CharClass::PLUS;
+        classes['-'] = CharClass::MINUS;
+        classes['='] = CharClass::EQUAL;
+        classes['<'] = CharClass::LESS;
+        classes['>'] = CharClass::GREATER;
+        classes['&'] = CharClass::AMPERSAND;
+        classes['|'] = CharClass::PIPE;
+        classes['/'] = CharClass::SLASH;
+        classes['*'] = CharClass::STAR;
+        classes[','] = CharClass::COMMA;
+        classes[';'] = CharClass::SEMICOLON;
+        classes['('] = CharClass::PARENTHESIS_OPEN;
+        classes[')'] = CharClass::PARENTHESIS_CLOSE;
+        classes['{'] = CharClass::CURLY_BRACKET_OPEN;
+        classes['}'] = CharClass::CURLY_BRACKET_CLOSE;
+
+        return classes;
+    }();
+
+    constexpr LexerTransition Go(const LexerState next, const LexerAction action = LexerAction::SKIP) {
+        return { .next = next, .action = action };
+    }
+
+    constexpr LexerTransition Emit(const TokenType token, const bool read = true) {
+        return { .action = read ? LexerAction::EMIT_READ : LexerAction::EMIT, .token = token };
+    }
+
+    constexpr LexerTransition Fail(const LexicalError error, const bool read) {
+        return { .action = read ? LexerAction::ERROR_READ : LexerAction::ERROR_INSTANT, .error = error };
+    }
+
+    using Row = std::array<LexerTransition, CLASS_COUNT>;
+
+    constexpr std::array<Row, STATE_COUNT> TRANSITIONS = [] {
+        using enum CharClass;
+        using S = LexerState;
+        using A = LexerAction;
+        using E = LexicalError;
+
+        std::array<Row, STATE_COUNT> table {};
+
+        const auto row = [&table](const S state) -> Row& {
+            return table[std::to_underlying(state)];
+        };
+
+        const auto fill = [](Row& r, const LexerTransition transition) {
+            r.fill(transition);
+        };
+
+        // Estado 0. Carácter desconocido.
+        Row& start = row(S::START);
+        fill(start, Fail(E::UNEXPECTED_START_CHARACTER, true));
+        start[std::to_underlying(SPACE)] = Go(S::START, A::SKIP_BLANKS);        // 0 : del : 0
+        start[std::to_underlying(BLANK)] = Go(S::START, A::SKIP_BLANKS);
+        start[std::to_underlying(LETTER)] = Go(S::IDENTIFIER, A::READ_IDENTIFIER); // 0 : l : 1
+        start[std::to_underlying(DIGIT)] = Go(S::INTEGER, A::READ_INTEGER);     // 0 : d : 3
+        start[std::to_underlying(QUOTE)] = Go(S::STRING, A::START_STRING);      // 0 : ' : 5
+        start[std::to_underlying(PLUS)] = Go(S::PLUS);                          // 0 : + : 8
+        start[std::to_underlying(MINUS)] = Emit(TokenType::SUB);                // 0 : - : 10
+        start[std::to_underlying(EQUAL)] = Emit(TokenType::ASSIGN);             // 0 : = : 10
+        start[std::to_underlying(LESS)] = Emit(TokenType::LESS);                // 0 : < : 10
+        start[std::to_underlying(GREATER)] = Emit(TokenType::GREATER);          // 0 : > : 10
+        start[std::to_underlying(AMPERSAND)] = Go(S::AMPERSAND);                // 0 : & : 11
+        start[std::to_underlying(PIPE)] = Go(S::PIPE);                          // 0 : | : 13
+        start[std::to_underlying(SLASH)] = Go(S::COMMENT_START);                // 0 : / : 15
+        start[std::to_underlying(COMMA)] = Emit(TokenType::COMMA);              // 0 : , : 18
+        start[std::to_underlying(SEMICOLON)] = Emit(TokenType::SEMICOLON);      // 0 : ; : 18
+        start[std::to_underlying(PARENTHESIS_OPEN)] = Emit(TokenType::PARENTHESIS_OPEN);
+        start[std::to_underlying(PARENTHESIS_CLOSE)] = Emit(TokenType::PARENTHESIS_CLOSE);
+        start[std::to_underlying(CURLY_BRACKET_OPEN)] = Emit(TokenType::CURLY_BRACKET_OPEN);
+        start[std::to_underlying(CURLY_BRACKET_CLOSE)] = Emit(TokenType::CURLY_BRACKET_CLOSE);
+        start[std::to_underlying(END_OF_FILE)] = Go(S::START, A::END_OF_FILE); // 0 : eof : 19
+
+        // 1 : oc : 2
+        Row& identifier = row(S::IDENTIFIER);
+        fill(identifier, Go(S::START, A::END_IDENTIFIER));
+        // 1 : l, d, _ : 1
+        for (const auto c : { LETTER, DIGIT, OTHER_ALNUM, UNDERSCORE })
+            identifier[std::to_underlying(c)] = Go(S::IDENTIFIER, A::READ_IDENTIFIER);
+
+        // 3 : oc : 4
+        Row& integer = row(S::INTEGER);
+        fill(integer, Go(S::START, A::END_INTEGER));
+        integer[std::to_underlying(DIGIT)] = Go(S::INTEGER, A::READ_INTEGER);   // 3 : d : 3
+
+        // 5 : oc : 5
+        Row& string = row(S::STRING);
+        fill(string, Go(S::STRING, A::APPEND_STRING));
+        string[std::to_underlying(QUOTE)] = Go(S::START, A::END_STRING);        // 5 : ' : 7
+        string[std::to_underlying(BACKSLASH)] = Go(S::STRING_ESCAPE);           // 5 : \ : 6
+        string[std::to_underlying(END_OF_FILE)] = Fail(E::MISSING_STRING_END, false);
+        string[std::to_underlying(BLANK)] = Fail(E::STRING_FORBIDDEN_CHARACTER, true);
+        string[std::to_underlying(CONTROL)] = Fail(E::STRING_FORBIDDEN_CHARACTER, true);
+
+        // 6 : cesc : 5. La acción comprueba que sea una secuencia de escape válida.
+        fill(row(S::STRING_ESCAPE), Go(S::STRING, A::APPEND_ESCAPED));
+
+        // 8 : oc : 9
+        Row& plus = row(S::PLUS);
+        fill(plus, Emit(TokenType::SUM, false));
+        plus[std::to_underlying(EQUAL)] = Emit(TokenType::CUMULATIVE_ASSIGN);   // 8 : = : 9
+
+        // 11 : & : 12
+        Row& ampersand = row(S::AMPERSAND);
+        fill(ampersand, Fail(E::MISSING_OP_AND, false));
+        ampersand[std::to_underlying(AMPERSAND)] = Emit(TokenType::AND);
+
+        // 13 : | : 14
+        Row& pipe = row(S::PIPE);
+        fill(pipe, Fail(E::MISSING_OP_OR, false));
+        pipe[std::to_underlying(PIPE)] = Emit(TokenType::OR);
+
+        // 15 : * : 16
+        Row& commentStart = row(S::COMMENT_START);
+        fill(commentStart, Fail(E::MISSING_COMMENT_START, false));
+        commentStart[std::to_underlying(STAR)] = Go(S::COMMENT);
+
+        // 16 : oc : 16
+        Row& comment = row(S::COMMENT);
+        fill(comment, Go(S::COMMENT, A::SKIP_COMMENT));
+        comment[std::to_underlying(STAR)] = Go(S::COMMENT_END);                 // 16 : * : 17
+        comment[std::to_underlying(END_OF_FILE)] = Fail(E::MISSING_COMMENT_END, false);
+
+        // 17 : oc : 16
+        Row& commentEnd = row(S::COMMENT_END);
+        fill(commentEnd, Go(S::COMMENT, A::SKIP_COMMENT));
+        commentEnd[std::to_underlying(SLASH)] = Go(S::START);                   // 17 : / : 0
+        commentEnd[std::to_underlying(STAR)] = Go(S::COMMENT_END);              // 17 : * : 17
+        commentEnd[std::to_underlying(END_OF_FILE)] = Fail(E::MISSING_COMMENT_END, false);
+
+        return table;
+    }();
+
+    /**
+     * Obtiene la clase de un carácter.
+     * @tparam AsciiOnly Si sólo se admiten caracteres ASCII fuera de las
+     *                   cadenas. En ese caso, el resto son de la clase OTHER.
+     */
+    template<bool AsciiOnly = false>
+    constexpr CharClass GetCharClass(const char32_t c) {
+        if (IsAscii(c))
+            return ASCII_CLASSES[c];
+
+        if (c == static_cast<char32_t>(EOF))
+            return CharClass::END_OF_FILE;
+
+        if constexpr (AsciiOnly)
+            return CharClass::OTHER;
+
+        if (IsAlphaUnicode(c))
+            return CharClass::LETTER;
+
+        if (IsAlnumUnicode(c))
+            return CharClass::OTHER_ALNUM;
+
+        return CharClass::OTHER;
+    }
+
+    /** Indica si un carácter de la clase dada continúa un identificador (1 : l, d, _ : 1). **/
+    constexpr bool IsIdentifierPart(const CharClass c) {
+        return TRANSITIONS[std::to_underlying(LexerState::IDENTIFIER)][std::to_underlying(c)].next == LexerState::IDENTIFIER;
+    }
+
+    /** Obtiene la transición desde un estado con un carácter de la clase dada. **/
+    inline const LexerTransition& GetTransition(const LexerState state, const CharClass c) {
+        return TRANSITIONS[std::to_underlying(state)][std::to_underlying(c)];
+    }
+}
@@ -4,83 +4,82 @@
 #pragma clang diagnostic ignored "misc-no-recursion"
 #pragma clang diagnostic ignored "bugprone-branch-clone"
 
-namespace {
-    void WriteParse(std::ostream& output, const GlobalState& globals, int transition) {
-        if (globals.syntaxPrint == SyntaxPrint::PARSE)
-            output << ' ' << transition;
-    }
-
-    void WriteCurrentTable(std::ostream& output, const GlobalState& globals) {
-        if (globals.syntaxPrint == SyntaxPrint::SYMBOLS) {
-            if (globals.localTable.has_value()) {
-                globals.localTable->WriteTable(output);
-            } else {
-                globals.globalTable->WriteTable(output);
-            }
-        }
+using enum TokenType;
 
-        output << std::endl;
-    }
+void Parser::WriteParse(GlobalState& globals, int transition) {
+    if (globals.syntaxPrint == SyntaxPrint::PARSE)
+        globals.parseTrace.AddProduction(transition);
+}
 
-    [[nodiscard]] bool IsFunction(const ValueProduct& type) {
-        const auto& values = type.GetStrings();
-        assert(!values.empty());
-        const bool res = values[0] == tFun;
-        assert(!res || values.size() >= 2);
-        return res;
+void Parser::WriteCurrentTable(GlobalState& globals) {
+    // La traza lleva sus propios saltos de línea.
+    if (globals.syntaxPrint == SyntaxPrint::PARSE) {
+        globals.parseTrace.AddLineBreak();
+        return;
     }
 
-    [[nodiscard]] ValueProduct GetFunctionReturnType(const ValueProduct& type) {
-        assert(IsFunction(type));
-        const auto& values = type.GetStrings();
-        return ValueProduct { values[1] };
+    if (globals.syntaxPrint == SyntaxPrint::SYMBOLS) {
+        if (globals.localTable.has_value()) {
+            globals.localTable->WriteTable(globals.tableOutput);
+        } else {
+            globals.globalTable->WriteTable(globals.tableOutput);
+        }
     }
 
-    [[nodiscard]] ValueProduct GetFunctionArgsType(const ValueProduct& type) {
-        assert(IsFunction(type));
+    globals.tableOutput << '\n';
+}
+
+bool Parser::IsFunction(const ValueProduct& type) {
+    const auto& values = type.GetStrings();
+    assert(!values.empty());
+    const bool res = values[0] == tFun;
+    assert(!res || values.size() >= 2);
+    return res;
+}
+
+ValueProduct Parser::GetFunctionReturnType(const ValueProduct& type) {
+    assert(IsFunction(type));
+    const auto& values = type.GetStrings();
+    return ValueProduct { values[1] };
+}
 
-        const auto& values = type.GetStrings();
+ValueProduct Parser::GetFunctionArgsType(const ValueProduct& type) {
+    assert(IsFunction(type));
 
-        ValueProduct res = {};
+    const auto& values = type.GetStrings();
 
-        if (values.size() == 2) {
-            res.Append(tVoid);
-        } else {
-            for (size_t i = 2; i < values.size(); i++) {
-                res.Append(values[i]);
-            }
-        }
+    ValueProduct res = {};
 
-        return res;
+    if (values.size() == 2) {
+        res.Append(tVoid);
+    } else {
+        for (size_t i = 2; i < values.size(); i++) {
+            res.Append(values[i]);
+        }
     }
-}
 
-using enum TokenType;
+    return res;
+}
 
-Parser::Attributes Parser::Axiom(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::Axiom(GlobalState& globals) {
     const AttributesPosRef axiom = CreateRuleAttributes();
 
     // P -> FUNCTION P | STATEMENT P | eof
     switch (m_currentToken.type) {
     // First (FUNCTION P)
     case FUNCTION: {
-        WriteParse(output, globals, 1);
+        WriteParse(globals, 1);
 
         // ------ //
 
-        const auto function = Function(output, globals);
+        Function(globals);
 
         // ------ //
 
-        const auto axiom_1 = Axiom(output, globals);
+        Axiom(globals);
 
-        if (globals.useSemantic) {
-            if (function.at(aType) == tError || axiom_1.at(aType) == tError) {
-                axiom[aType] = tError;
-            } else {
-                axiom[aType] = tOk;
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(1, 1, axiom, globals);
 
         // ------ //
 
@@ -95,23 +94,18 @@ Parser::Attributes Parser::Axiom(std::ostream& output, GlobalState& globals) {
     case OUTPUT:
     case INPUT:
     case RETURN: {
-        WriteParse(output, globals, 2);
+        WriteParse(globals, 2);
 
         // ------ //
 
-        const auto statement = Statement(output, globals);
+        Statement(globals);
 
         // ------ //
 
-        const auto axiom_1 = Axiom(output, globals);
+        Axiom(globals);
 
-        if (globals.useSemantic) {
-            if (statement.at(aType) == tError || axiom_1.at(aType) == tError) {
-                axiom[aType] = tError;
-            } else {
-                axiom[aType] = tOk;
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(2, 1, axiom, globals);
 
         // ------ //
 
@@ -120,13 +114,12 @@ Parser::Attributes Parser::Axiom(std::ostream& output, GlobalState& globals) {
 
     // First (eof)
     case END: {
-        WriteParse(output, globals, 3);
+        WriteParse(globals, 3);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            axiom[aType] = tOk;
-        }
+        if (globals.useSemantic)
+            RunAction(3, 1, axiom, globals);
 
         // ------ //
 
@@ -137,28 +130,27 @@ Parser::Attributes Parser::Axiom(std::ostream& output, GlobalState& globals) {
         ThrowSyntaxError(SyntaxError::TOP_LEVEL_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(axiom);
 }
 
-Parser::Attributes Parser::Function(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::Function(GlobalState& globals) {
     const AttributesPosRef function = CreateRuleAttributes();
 
     // FUNCTION -> function FUNTYPE id ( FUNATTRIBUTES ) { BODY }
 
     assert(m_currentToken.type == FUNCTION);
-    WriteParse(output, globals, 4);
+    WriteParse(globals, 4);
 
     // ------ //
 
-    if (globals.useSemantic) {
-        globals.implicitDeclaration = false;
-    }
+    if (globals.useSemantic)
+        RunAction(4, 1, function, globals);
 
     GetNextToken(globals);
 
     // ------ //
 
-    const auto funType = FunType(output, globals);
+    FunType(globals);
 
     // ------ //
 
@@ -166,11 +158,8 @@ Parser::Attributes Parser::Function(std::ostream& output, GlobalState& globals)
 
     const auto id = m_currentToken;
 
-    if (globals.useSemantic) {
-        globals.localTable = SymbolTable(globals.tableCounter);
-        globals.tableCounter += 1;
-        globals.localOffset = 0;
-    }
+    if (globals.useSemantic)
+        RunAction(4, 2, function, globals);
 
     GetNextToken(globals);
 
@@ -182,27 +171,10 @@ Parser::Attributes Parser::Function(std::ostream& output, GlobalState& globals)
 
     // ------ //
 
-    const auto funAttributes = FunAttributes(output, globals);
+    FunAttributes(globals);
 
-    if (globals.useSemantic) {
-        const auto& pos = std::get<SymbolPos>(id.attribute);
-
-        if (globals.HasType(pos)) {
-            function[aType] = tError;
-            LogSemanticError(
-                globals,
-                id,
-                SemanticError::IDENTIFIER_ALREADY_EXISTS,
-                "El nombre de la función ya está en uso."
-            );
-        } else {
-            function[aType] = funAttributes.at(aType);
-            globals.AddFunctionType(pos, funType.at(aType), funAttributes.at(aValueType));
-            globals.AddFunctionTag(pos);
-        }
-
-        globals.implicitDeclaration = true;
-    }
+    if (globals.useSemantic)
+        RunAction(4, 3, function, globals, id);
 
     // ------ //
 
@@ -218,56 +190,35 @@ Parser::Attributes Parser::Function(std::ostream& output, GlobalState& globals)
 
     // ------ //
 
-    const auto body = Body(output, globals);
+    Body(globals);
 
     // ------ //
 
     VerifyTokenType(CURLY_BRACKET_CLOSE, SyntaxError::FUNCTION_MISSING_BRACK_CLOSE);
 
-    if (globals.useSemantic) {
-        if (funType.at(aType) != body.at(aValueType)) {
-            function[aType] = tError;
-
-            const auto& pos = std::get<SymbolPos>(id.attribute);
-            LogSemanticError(
-                globals,
-                funType,
-                SemanticError::INVALID_RETURN_TYPE,
-                std::format(
-                    "El tipo de retorno de la función «{}» («{}») no coincide con el "
-                    "devuelto («{}»).",
-                    globals.GetSymbolName(pos),
-                    funType.at(aType).ToReadableString(),
-                    body.at(aValueType).ToReadableString()
-                )
-            );
-        }
-
-        WriteCurrentTable(output, globals);
-        globals.localTable = std::nullopt;
-    }
+    if (globals.useSemantic)
+        RunAction(4, 4, function, globals, id);
 
     GetNextToken(globals);
 
     // ------ //
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(function);
 }
 
-Parser::Attributes Parser::FunType(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::FunType(GlobalState& globals) {
     const AttributesPosRef funType = CreateRuleAttributes();
 
     // FUNTYPE -> void | VARTYPE
     switch (m_currentToken.type) {
     // First (void)
     case VOID: {
-        WriteParse(output, globals, 5);
+        WriteParse(globals, 5);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            funType[aType] = tVoid;
-        }
+        if (globals.useSemantic)
+            RunAction(5, 1, funType, globals);
 
         GetNextToken(globals);
 
@@ -280,15 +231,14 @@ Parser::Attributes Parser::FunType(std::ostream& output, GlobalState& globals) {
     case INT:
     case BOOL:
     case STRING: {
-        WriteParse(output, globals, 6);
+        WriteParse(globals, 6);
 
         // ------ //
 
-        const auto varType = VarType(output, globals);
+        VarType(globals);
 
-        if (globals.useSemantic) {
-            funType[aType] = varType.at(aType);
-        }
+        if (globals.useSemantic)
+            RunAction(6, 1, funType, globals);
 
         // ------ //
 
@@ -299,24 +249,22 @@ Parser::Attributes Parser::FunType(std::ostream& output, GlobalState& globals) {
         ThrowSyntaxError(SyntaxError::FUNTYPE_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(funType);
 }
 
-Parser::Attributes Parser::VarType(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::VarType(GlobalState& globals) {
     const AttributesPosRef varType = CreateRuleAttributes();
 
     // VARTYPE -> int | boolean | string
     switch (m_currentToken.type) {
     // First (int)
     case INT: {
-        WriteParse(output, globals, 7);
+        WriteParse(globals, 7);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            varType[aType] = tInt;
-            varType[aWidth] = wInt;
-        }
+        if (globals.useSemantic)
+            RunAction(7, 1, varType, globals);
 
         GetNextToken(globals);
 
@@ -327,14 +275,12 @@ Parser::Attributes Parser::VarType(std::ostream& output, GlobalState& globals) {
 
     // First (bool)
     case BOOL: {
-        WriteParse(output, globals, 8);
+        WriteParse(globals, 8);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            varType[aType] = tLog;
-            varType[aWidth] = wLog;
-        }
+        if (globals.useSemantic)
+            RunAction(8, 1, varType, globals);
 
         GetNextToken(globals);
 
@@ -345,14 +291,12 @@ Parser::Attributes Parser::VarType(std::ostream& output, GlobalState& globals) {
 
     // First (string)
     case STRING: {
-        WriteParse(output, globals, 9);
+        WriteParse(globals, 9);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            varType[aType] = tStr;
-            varType[aWidth] = wStr;
-        }
+        if (globals.useSemantic)
+            RunAction(9, 1, varType, globals);
 
         GetNextToken(globals);
 
@@ -368,24 +312,22 @@ Parser::Attributes Parser::VarType(std::ostream& output, GlobalState& globals) {
         ThrowSyntaxError(SyntaxError::VARTYPE_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(varType);
 }
 
-Parser::Attributes Parser::FunAttributes(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::FunAttributes(GlobalState& globals) {
     const AttributesPosRef funAttributes = CreateRuleAttributes();
 
     // FUNATTRIBUTES -> void | VARTYPE id NEXTATTRIBUTE
     switch (m_currentToken.type) {
     // First (void)
     case VOID: {
-        WriteParse(output, globals, 10);
+        WriteParse(globals, 10);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            funAttributes[aType] = tOk;
-            funAttributes[aValueType] = tVoid;
-        }
+        if (globals.useSemantic)
+            RunAction(10, 1, funAttributes, globals);
 
         GetNextToken(globals);
 
@@ -398,11 +340,11 @@ Parser::Attributes Parser::FunAttributes(std::ostream& output, GlobalState& glob
     case INT:
     case BOOL:
     case STRING: {
-        WriteParse(output, globals, 11);
+        WriteParse(globals, 11);
 
         // ------ //
 
-        const auto varType = VarType(output, globals);
+        VarType(globals);
 
         // ------ //
 
@@ -410,42 +352,17 @@ Parser::Attributes Parser::FunAttributes(std::ostream& output, GlobalState& glob
 
         const auto id = m_currentToken;
 
-        if (globals.useSemantic) {
-            const auto& pos = std::get<SymbolPos>(id.attribute);
-
-            if (globals.HasType(pos)) {
-                funAttributes[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    id,
-                    SemanticError::IDENTIFIER_ALREADY_EXISTS,
-                    "El nombre de este atributo ya está en uso."
-                );
-            } else {
-                funAttributes[aType] = tOk;
-                globals.AddType(pos, varType.at(aType));
-                globals.AddOffset(pos, globals.localOffset);
-                globals.localOffset += varType.at(aWidth);
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(11, 1, funAttributes, globals, id);
 
         GetNextToken(globals);
 
         // ------ //
 
-        const auto nextAttributes = NextAttributes(output, globals);
+        NextAttributes(globals);
 
-        if (globals.useSemantic) {
-            if (nextAttributes.at(aType) == tError) {
-                funAttributes[aType] = tError;
-            }
-
-            if (nextAttributes.at(aValueType) != tVoid) {
-                funAttributes[aValueType] = varType.at(aType) * nextAttributes.at(aValueType);
-            } else {
-                funAttributes[aValueType] = varType.at(aType);
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(11, 2, funAttributes, globals);
 
         // ------ //
 
@@ -459,17 +376,17 @@ Parser::Attributes Parser::FunAttributes(std::ostream& output, GlobalState& glob
         ThrowSyntaxError(SyntaxError::FUNATTRIBUTES_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(funAttributes);
 }
 
-Parser::Attributes Parser::NextAttributes(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::NextAttributes(GlobalState& globals) {
     const AttributesPosRef nextAttributes = CreateRuleAttributes();
 
     // NEXTATTRIBUTE -> , VARTYPE id NEXTATTRIBUTE | lambda
     switch (m_currentToken.type) {
     // First (, VARTYPE id NEXTATTRIBUTE)
     case COMMA: {
-        WriteParse(output, globals, 12);
+        WriteParse(globals, 12);
 
         // ------ //
 
@@ -477,7 +394,7 @@ Parser::Attributes Parser::NextAttributes(std::ostream& output, GlobalState& glo
 
         // ------ //
 
-        const auto varType = VarType(output, globals);
+        VarType(globals);
 
         // ------ //
 
@@ -485,42 +402,17 @@ Parser::Attributes Parser::NextAttributes(std::ostream& output, GlobalState& glo
 
         const auto id = m_currentToken;
 
-        if (globals.useSemantic) {
-            const auto& pos = std::get<SymbolPos>(id.attribute);
-
-            if (globals.HasType(pos)) {
-                nextAttributes[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    id,
-                    SemanticError::IDENTIFIER_ALREADY_EXISTS,
-                    "El nombre de este atributo ya está en uso."
-                );
-            } else {
-                nextAttributes[aType] = tOk;
-                globals.AddType(pos, varType.at(aType));
-                globals.AddOffset(pos, globals.localOffset);
-                globals.localOffset += varType.at(aWidth);
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(12, 1, nextAttributes, globals, id);
 
         GetNextToken(globals);
 
         // ------ //
 
-        const auto nextAttributes_1 = NextAttributes(output, globals);
-
-        if (globals.useSemantic) {
-            if (nextAttributes.at(aType) == tError) {
-                nextAttributes[aType] = tError;
-            }
+        NextAttributes(globals);
 
-            if (nextAttributes_1.at(aValueType) != tVoid) {
-                nextAttributes[aValueType] = varType.at(aType) * nextAttributes_1.at(aValueType);
-            } else {
-                nextAttributes[aValueType] = varType.at(aType);
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(12, 2, nextAttributes, globals);
 
         // ------ //
 
@@ -529,14 +421,12 @@ Parser::Attributes Parser::NextAttributes(std::ostream& output, GlobalState& glo
 
     // Como NEXTATTRIBUTE -> lambda, Follow (NEXTATTRIBUTE)
     default: {
-        WriteParse(output, globals, 13);
+        WriteParse(globals, 13);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            nextAttributes[aType] = tOk;
-            nextAttributes[aValueType] = tVoid;
-        }
+        if (globals.useSemantic)
+            RunAction(13, 1, nextAttributes, globals);
 
         // ------ //
 
@@ -544,10 +434,10 @@ Parser::Attributes Parser::NextAttributes(std::ostream& output, GlobalState& glo
     }
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(nextAttributes);
 }
 
-Parser::Attributes Parser::Body(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::Body(GlobalState& globals) {
     const AttributesPosRef body = CreateRuleAttributes();
 
     // BODY -> STATEMENT BODY | lambda
@@ -560,31 +450,18 @@ Parser::Attributes Parser::Body(std::ostream& output, GlobalState& globals) {
     case OUTPUT:
     case INPUT:
     case RETURN: {
-        WriteParse(output, globals, 14);
+        WriteParse(globals, 14);
 
         // ------ //
 
-        const auto statement = Statement(output, globals);
+        Statement(globals);
 
         // ------ //
 
-        const auto body_1 = Body(output, globals);
+        Body(globals);
 
-        if (globals.useSemantic) {
-            if (statement.at(aType) == tOk) {
-                body[aType] = body_1.at(aType);
-            } else {
-                body[aType] = tError;
-            }
-
-            if (statement.at(aValueType) == body_1.at(aValueType) || statement.at(aValueType) == tVoid) {
-                body[aValueType] = body_1.at(aValueType);
-            } else if (body_1.at(aValueType) == tVoid) {
-                body[aValueType] = statement.at(aValueType);
-            } else {
-                body[aValueType] = tError;
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(14, 1, body, globals);
 
         // ------ //
 
@@ -593,14 +470,12 @@ Parser::Attributes Parser::Body(std::ostream& output, GlobalState& globals) {
 
     // Como BODY -> lambda, Follow (BODY)
     default: {
-        WriteParse(output, globals, 15);
+        WriteParse(globals, 15);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            body[aType] = tOk;
-            body[aValueType] = tVoid;
-        }
+        if (globals.useSemantic)
+            RunAction(15, 1, body, globals);
 
         // ------ //
 
@@ -608,10 +483,10 @@ Parser::Attributes Parser::Body(std::ostream& output, GlobalState& globals) {
     }
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(body);
 }
 
-Parser::Attributes Parser::Statement(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::Statement(GlobalState& globals) {
     const AttributesPosRef statement = CreateRuleAttributes();
 
     // STATEMENT -> if ( EXP1 ) ATOMSTATEMENT | for ( FORACT ; EXP1 ; FORACT ) { BODY } |
@@ -619,7 +494,7 @@ Parser::Attributes Parser::Statement(std::ostream& output, GlobalState& globals)
     switch (m_currentToken.type) {
     // First (if ( EXP1 ) ATOMSTATEMENT)
     case IF: {
-        WriteParse(output, globals, 16);
+        WriteParse(globals, 16);
 
         // ------ //
 
@@ -633,27 +508,10 @@ Parser::Attributes Parser::Statement(std::ostream& output, GlobalState& globals)
 
         // ------ //
 
-        const auto exp1 = Exp1(output, globals);
-
-        if (globals.useSemantic) {
-            if (exp1.at(aType) == tError) {
-                statement[aType] = tError;
-            } else if (exp1.at(aType) != tLog) {
-                LogSemanticError(
-                    globals,
-                    exp1,
-                    SemanticError::INVALID_IF_CONDITION_TYPE,
-                    std::format(
-                        "El argumento de «if» debe ser de tipo «boolean». El tipo "
-                        "evaluado es «{}».",
-                        exp1.at(aType).ToReadableString()
-                    )
-                );
-                statement[aType] = tError;
-            } else {
-                statement[aType] = tOk;
-            }
-        }
+        Exp1(globals);
+
+        if (globals.useSemantic)
+            RunAction(16, 1, statement, globals);
 
         // ------ //
 
@@ -663,15 +521,10 @@ Parser::Attributes Parser::Statement(std::ostream& output, GlobalState& globals)
 
         // ------ //
 
-        const auto atomStatement = AtomStatement(output, globals);
-
-        if (globals.useSemantic) {
-            if (statement.at(aType) != tError) {
-                statement[aType] = atomStatement.at(aType);
-            }
+        AtomStatement(globals);
 
-            statement[aValueType] = atomStatement.at(aValueType);
-        }
+        if (globals.useSemantic)
+            RunAction(16, 2, statement, globals);
 
         // ------ //
 
@@ -680,7 +533,7 @@ Parser::Attributes Parser::Statement(std::ostream& output, GlobalState& globals)
 
     // First (for ( FORACT ; EXP1 ; FORACT ) { BODY })
     case FOR: {
-        WriteParse(output, globals, 17);
+        WriteParse(globals, 17);
 
         // ------ //
 
@@ -694,15 +547,10 @@ Parser::Attributes Parser::Statement(std::ostream& output, GlobalState& globals)
 
         // ------ //
 
-        const auto forAct_1 = ForAct(output, globals);
+        ForAct(globals);
 
-        if (globals.useSemantic) {
-            if (forAct_1.at(aType) == tError) {
-                statement[aType] = tError;
-            } else {
-                statement[aType] = tOk;
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(17, 1, statement, globals);
 
         // ------ //
 
@@ -712,25 +560,10 @@ Parser::Attributes Parser::Statement(std::ostream& output, GlobalState& globals)
 
         // ------ //
 
-        const auto exp1 = Exp1(output, globals);
-
-        if (globals.useSemantic) {
-            if (exp1.at(aType) == tError) {
-                statement[aType] = tError;
-            } else if (exp1.at(aType) != tLog) {
-                statement[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    exp1,
-                    SemanticError::INVALID_FOR_CONDITION_TYPE,
-                    std::format(
-                        "El segundo argumento de «for» debe ser de tipo «boolean». El tipo "
-                        "evaluado es «{}».",
-                        exp1.at(aType).ToReadableString()
-                    )
-                );
-            }
-        }
+        Exp1(globals);
+
+        if (globals.useSemantic)
+            RunAction(17, 2, statement, globals);
 
         // ------ //
 
@@ -740,13 +573,10 @@ Parser::Attributes Parser::Statement(std::ostream& output, GlobalState& globals)
 
         // ------ //
 
-        const auto forAct_2 = ForAct(output, globals);
+        ForAct(globals);
 
-        if (globals.useSemantic) {
-            if (forAct_2.at(aType) == tError) {
-                statement[aType] = tError;
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(17, 3, statement, globals);
 
         // ------ //
 
@@ -762,16 +592,14 @@ Parser::Attributes Parser::Statement(std::ostream& output, GlobalState& globals)
 
         // ------ //
 
-        const auto body = Body(output, globals);
+        Body(globals);
 
         // ------ //
 
         VerifyTokenType(CURLY_BRACKET_CLOSE, SyntaxError::STATEMENT_FOR_MISSING_BRACK_CLOSE);
 
-        if (globals.useSemantic) {
-            statement[aType] = body.at(aType);
-            statement[aValueType] = body.at(aValueType);
-        }
+        if (globals.useSemantic)
+            RunAction(17, 4, statement, globals);
 
         GetNextToken(globals);
 
@@ -782,19 +610,18 @@ Parser::Attributes Parser::Statement(std::ostream& output, GlobalState& globals)
 
     // First (var VARTYPE id ;)
     case VAR: {
-        WriteParse(output, globals, 18);
+        WriteParse(globals, 18);
 
         // ------ //
 
         GetNextToken(globals);
 
-        if (globals.useSemantic) {
-            globals.implicitDeclaration = false;
-        }
+        if (globals.useSemantic)
+            RunAction(18, 1, statement, globals);
 
         // ------ //
 
-        const auto varType = VarType(output, globals);
+        VarType(globals);
 
         // ------ //
 
@@ -802,29 +629,8 @@ Parser::Attributes Parser::Statement(std::ostream& output, GlobalState& globals)
 
         const auto id = m_currentToken;
 
-        if (globals.useSemantic) {
-            const auto& pos = std::get<SymbolPos>(id.attribute);
-
-            statement[aValueType] = tVoid;
-
-            if (globals.HasType(pos)) {
-                statement[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    id,
-                    SemanticError::IDENTIFIER_ALREADY_EXISTS,
-                    "El nombre de la variable a declarar ya está en uso."
-                );
-            } else {
-                globals.AddType(pos, varType.at(aType));
-                auto& offset = globals.CurrentOffset();
-                globals.AddOffset(pos, offset);
-                offset += varType.at(aWidth);
-                statement[aType] = tOk;
-            }
-
-            globals.implicitDeclaration = true;
-        }
+        if (globals.useSemantic)
+            RunAction(18, 2, statement, globals, id);
 
         GetNextToken(globals);
 
@@ -844,16 +650,14 @@ Parser::Attributes Parser::Statement(std::ostream& output, GlobalState& globals)
     case OUTPUT:
     case INPUT:
     case RETURN: {
-        WriteParse(output, globals, 19);
+        WriteParse(globals, 19);
 
         // ------ //
 
-        const auto atomStatement = AtomStatement(output, globals);
+        AtomStatement(globals);
 
-        if (globals.useSemantic) {
-            statement[aType] = atomStatement.at(aType);
-            statement[aValueType] = atomStatement.at(aValueType);
-        }
+        if (globals.useSemantic)
+            RunAction(19, 1, statement, globals);
 
         // ------ //
 
@@ -864,17 +668,17 @@ Parser::Attributes Parser::Statement(std::ostream& output, GlobalState& globals)
         ThrowSyntaxError(SyntaxError::STATEMENT_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(statement);
 }
 
-Parser::Attributes Parser::AtomStatement(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::AtomStatement(GlobalState& globals) {
     const AttributesPosRef atomStatement = CreateRuleAttributes();
 
     // ATOMSTATEMENT -> id IDACT ; | output EXP1 ; | input id ; | return RETURNEXP ;
     switch (m_currentToken.type) {
     // First (id IDACT ;)
     case IDENTIFIER: {
-        WriteParse(output, globals, 20);
+        WriteParse(globals, 20);
 
         // ------ //
 
@@ -884,71 +688,10 @@ Parser::Attributes Parser::AtomStatement(std::ostream& output, GlobalState& glob
 
         // ------ //
 
-        const auto idAct = IdAct(output, globals);
-
-        if (globals.useSemantic) {
-            const auto& pos = std::get<SymbolPos>(id.attribute);
-            const auto type = globals.GetType(pos);
-
-            atomStatement[aValueType] = tVoid;
-
-            if (idAct.at(aFunCall)) {
-                if (!IsFunction(type)) {
-                    atomStatement[aType] = tError;
-                    LogSemanticError(
-                        globals,
-                        atomStatement,
-                        SemanticError::INCOHERENT_VARIABLE_AS_FUNCTION_TYPES,
-                        "No se puede llamar a una variable como si fuera una función."
-                    );
-                } else if (idAct.at(aType) == tError) {
-                    atomStatement[aType] = tError;
-                } else if (idAct.at(aType) == GetFunctionArgsType(type)) {
-                    atomStatement[aType] = tOk;
-                } else {
-                    atomStatement[aType] = tError;
-                    LogSemanticError(
-                        globals,
-                        idAct,
-                        SemanticError::INCOHERENT_CALL_PARAM_TYPES,
-                        std::format(
-                            "Los tipos de los argumentos de llamada a la función no "
-                            "coinciden con los de la definición. Se esperaba «{}», "
-                            "pero se recibió «{}».",
-                            GetFunctionArgsType(type).ToReadableString(),
-                            idAct.at(aType).ToReadableString()
-                        )
-                    );
-                }
-            } else {
-                if (IsFunction(type)) {
-                    atomStatement[aType] = tError;
-                    LogSemanticError(
-                        globals,
-                        idAct,
-                        SemanticError::INCOHERENT_FUNCTION_AS_VARIABLE_TYPES,
-                        "No se puede asignar valores a una función."
-                    );
-                } else if (idAct.at(aType) == tError) {
-                    atomStatement[aType] = tError;
-                } else if (idAct.at(aType) == type) {
-                    atomStatement[aType] = tOk;
-                } else {
-                    atomStatement[aType] = tError;
-                    LogSemanticError(
-                        globals,
-                        idAct,
-                        SemanticError::INCOHERENT_TYPES,
-                        std::format(
-                            "Los tipos a ambos lados de la asignación no coinciden. "
-                            "La variable es de tipo «{}», pero la expresión es «{}».",
-                            type.ToReadableString(),
-                            idAct.at(aType).ToReadableString()
-                        )
-                    );
-                }
-            }
-        }
+        IdAct(globals);
+
+        if (globals.useSemantic)
+            RunAction(20, 1, atomStatement, globals, id);
 
         // ------ //
 
@@ -963,7 +706,7 @@ Parser::Attributes Parser::AtomStatement(std::ostream& output, GlobalState& glob
 
     // First (output EXP1 ;)
     case OUTPUT: {
-        WriteParse(output, globals, 21);
+        WriteParse(globals, 21);
 
         // ------ //
 
@@ -971,29 +714,10 @@ Parser::Attributes Parser::AtomStatement(std::ostream& output, GlobalState& glob
 
         // ------ //
 
-        const auto exp1 = Exp1(output, globals);
-
-        if (globals.useSemantic) {
-            atomStatement[aValueType] = tVoid;
-
-            if (exp1.at(aType) == tError) {
-                atomStatement[aType] = tError;
-            } else if (exp1.at(aType) == tStr || exp1.at(aType) == tInt) {
-                atomStatement[aType] = tOk;
-            } else {
-                atomStatement[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    exp1,
-                    SemanticError::INVALID_OUTPUT_TYPE,
-                    std::format(
-                        "Una expresión con tipo «{}» no se puede mostrar con «output». "
-                        "«output» permite mostrar «int» y «string».",
-                        exp1.at(aType).ToReadableString()
-                    )
-                );
-            }
-        }
+        Exp1(globals);
+
+        if (globals.useSemantic)
+            RunAction(21, 1, atomStatement, globals);
 
         // ------ //
 
@@ -1008,7 +732,7 @@ Parser::Attributes Parser::AtomStatement(std::ostream& output, GlobalState& glob
 
     // First (input id ;)
     case INPUT: {
-        WriteParse(output, globals, 22);
+        WriteParse(globals, 22);
 
         // ------ //
 
@@ -1020,28 +744,8 @@ Parser::Attributes Parser::AtomStatement(std::ostream& output, GlobalState& glob
 
         const auto id = m_currentToken;
 
-        if (globals.useSemantic) {
-            const auto& pos = std::get<SymbolPos>(id.attribute);
-            const auto type = globals.GetType(pos);
-
-            atomStatement[aValueType] = tVoid;
-
-            if (type == tStr || type == tInt) {
-                atomStatement[aType] = tOk;
-            } else {
-                atomStatement[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    id,
-                    SemanticError::INVALID_INPUT_TYPE,
-                    std::format(
-                        "Un objeto tipo «{}» no se puede usar con «input». "
-                        "«input» acepta variables de tipo «int» o «string».",
-                        type.ToReadableString()
-                    )
-                );
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(22, 1, atomStatement, globals, id);
 
         GetNextToken(globals);
 
@@ -1058,7 +762,7 @@ Parser::Attributes Parser::AtomStatement(std::ostream& output, GlobalState& glob
 
     // First (return RETURNEXP ;)
     case RETURN: {
-        WriteParse(output, globals, 23);
+        WriteParse(globals, 23);
 
         // ------ //
 
@@ -1066,17 +770,10 @@ Parser::Attributes Parser::AtomStatement(std::ostream& output, GlobalState& glob
 
         // ------ //
 
-        const auto returnExp = ReturnExp(output, globals);
-
-        if (globals.useSemantic) {
-            if (returnExp.at(aType) != tError) {
-                atomStatement[aType] = tOk;
-            } else {
-                atomStatement[aType] = tError;
-            }
+        ReturnExp(globals);
 
-            atomStatement[aValueType] = returnExp.at(aType);
-        }
+        if (globals.useSemantic)
+            RunAction(23, 1, atomStatement, globals);
 
         // ------ //
 
@@ -1093,10 +790,10 @@ Parser::Attributes Parser::AtomStatement(std::ostream& output, GlobalState& glob
         ThrowSyntaxError(SyntaxError::STATEMENT_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(atomStatement);
 }
 
-Parser::Attributes Parser::IdAct(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::IdAct(GlobalState& globals) {
     const AttributesPosRef idAct = CreateRuleAttributes();
 
     // IDACT -> ASS EXP1 | ( CALLPARAMS )
@@ -1104,43 +801,18 @@ Parser::Attributes Parser::IdAct(std::ostream& output, GlobalState& globals) {
     // First (ASS EXP1)
     case ASSIGN:
     case CUMULATIVE_ASSIGN: {
-        WriteParse(output, globals, 24);
+        WriteParse(globals, 24);
 
         // ------ //
 
-        const auto ass = Ass(output, globals);
+        Ass(globals);
 
         // ------ //
 
-        const auto exp1 = Exp1(output, globals);
-
-        if (globals.useSemantic) {
-            const auto& type = exp1.at(aType);
+        Exp1(globals);
 
-            idAct[aFunCall] = false;
-
-            if (ass.at(aSum)) {
-                if (type == tInt || type == tStr) {
-                    idAct[aType] = type;
-                } else {
-                    idAct[aType] = tError;
-                    LogSemanticError(
-                        globals,
-                        exp1,
-                        SemanticError::INVALID_TYPE,
-                        std::format(
-                            "Sólo se puede incrementar con expresiones de tipo "
-                            "«int» o concatenar con expresiones de tipo "
-                            "«string». El tipo actual es {}.",
-                            type.ToReadableString(),
-                            idAct.at(aType).ToReadableString()
-                        )
-                    );
-                }
-            } else {
-                idAct[aType] = type;
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(24, 1, idAct, globals);
 
         // ------ //
 
@@ -1149,7 +821,7 @@ Parser::Attributes Parser::IdAct(std::ostream& output, GlobalState& globals) {
 
     // First (( CALLPARAMS ))
     case PARENTHESIS_OPEN: {
-        WriteParse(output, globals, 25);
+        WriteParse(globals, 25);
 
         // ------ //
 
@@ -1157,12 +829,10 @@ Parser::Attributes Parser::IdAct(std::ostream& output, GlobalState& globals) {
 
         // ------ //
 
-        const auto callParams = CallParams(output, globals);
+        CallParams(globals);
 
-        if (globals.useSemantic) {
-            idAct[aFunCall] = true;
-            idAct[aType] = callParams.at(aType);
-        }
+        if (globals.useSemantic)
+            RunAction(25, 1, idAct, globals);
 
         // ------ //
 
@@ -1179,17 +849,17 @@ Parser::Attributes Parser::IdAct(std::ostream& output, GlobalState& globals) {
         ThrowSyntaxError(SyntaxError::IDACT_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(idAct);
 }
 
-Parser::Attributes Parser::ForAct(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::ForAct(GlobalState& globals) {
     const AttributesPosRef forAct = CreateRuleAttributes();
 
     // FORACT -> id ASS EXP1 | lambda
     switch (m_currentToken.type) {
     // First (id ASS EXP1)
     case IDENTIFIER: {
-        WriteParse(output, globals, 26);
+        WriteParse(globals, 26);
 
         // ------ //
 
@@ -1199,44 +869,14 @@ Parser::Attributes Parser::ForAct(std::ostream& output, GlobalState& globals) {
 
         // ------ //
 
-        const auto ass = Ass(output, globals);
-
-        // ------ //
-
-        const auto exp1 = Exp1(output, globals);
-
-        if (globals.useSemantic) {
-            const auto& pos = std::get<SymbolPos>(id.attribute);
-            const auto type = globals.GetType(pos);
-
-            if (type != tInt) {
-                forAct[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    id,
-                    SemanticError::INVALID_FOR_ACTION_TYPE,
-                    std::format(
-                        "El tipo de una variable en «for» debe de ser «int». El tipo actual es «{}».",
-                        type.ToReadableString()
-                    )
-                );
-            } else if (exp1.at(aType) == tError) {
-                forAct[aType] = tError;
-            } else if (exp1.at(aType) != tInt) {
-                forAct[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    exp1,
-                    SemanticError::INCOHERENT_TYPES,
-                    std::format(
-                        "Se esperaba una expresión con tipo «int». El tipo de la expresión es «{}».",
-                        exp1.at(aType).ToReadableString()
-                    )
-                );
-            } else {
-                forAct[aType] = tOk;
-            }
-        }
+        Ass(globals);
+
+        // ------ //
+
+        Exp1(globals);
+
+        if (globals.useSemantic)
+            RunAction(26, 1, forAct, globals, id);
 
         // ------ //
 
@@ -1245,13 +885,12 @@ Parser::Attributes Parser::ForAct(std::ostream& output, GlobalState& globals) {
 
     // Como FORACT -> lambda, Follow (FORACT)
     default: {
-        WriteParse(output, globals, 27);
+        WriteParse(globals, 27);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            forAct[aType] = tOk;
-        }
+        if (globals.useSemantic)
+            RunAction(27, 1, forAct, globals);
 
         // ------ //
 
@@ -1259,24 +898,23 @@ Parser::Attributes Parser::ForAct(std::ostream& output, GlobalState& globals) {
     }
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(forAct);
 }
 
-Parser::Attributes Parser::Ass(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::Ass(GlobalState& globals) {
     const AttributesPosRef ass = CreateRuleAttributes();
 
     // ASS -> = | +=
     switch (m_currentToken.type) {
     case ASSIGN: {
-        WriteParse(output, globals, 28);
+        WriteParse(globals, 28);
 
         // ------ //
 
         GetNextToken(globals);
 
-        if (globals.useSemantic) {
-            ass[aSum] = false;
-        }
+        if (globals.useSemantic)
+            RunAction(28, 1, ass, globals);
 
         // ------ //
 
@@ -1284,15 +922,14 @@ Parser::Attributes Parser::Ass(std::ostream& output, GlobalState& globals) {
     }
 
     case CUMULATIVE_ASSIGN: {
-        WriteParse(output, globals, 29);
+        WriteParse(globals, 29);
 
         // ------ //
 
         GetNextToken(globals);
 
-        if (globals.useSemantic) {
-            ass[aSum] = true;
-        }
+        if (globals.useSemantic)
+            RunAction(29, 1, ass, globals);
 
         // ------ //
 
@@ -1303,10 +940,10 @@ Parser::Attributes Parser::Ass(std::ostream& output, GlobalState& globals) {
         ThrowSyntaxError(SyntaxError::ASS_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(ass);
 }
 
-Parser::Attributes Parser::CallParams(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::CallParams(GlobalState& globals) {
     const AttributesPosRef callParams = CreateRuleAttributes();
 
     // CALLPARAM -> EXP1 NEXTPARAM | lambda
@@ -1318,25 +955,18 @@ Parser::Attributes Parser::CallParams(std::ostream& output, GlobalState& globals
     case FALSE:
     case TRUE:
     case IDENTIFIER: {
-        WriteParse(output, globals, 30);
+        WriteParse(globals, 30);
 
         // ------ //
 
-        const auto exp1 = Exp1(output, globals);
+        Exp1(globals);
 
         // ------ //
 
-        const auto nextParams = NextParams(output, globals);
+        NextParams(globals);
 
-        if (globals.useSemantic) {
-            if (exp1.at(aType) == tError || nextParams.at(aType) == tError) {
-                callParams[aType] = tError;
-            } else if (nextParams.at(aType) != tVoid) {
-                callParams[aType] = exp1.at(aType) * nextParams.at(aType);
-            } else {
-                callParams[aType] = exp1.at(aType);
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(30, 1, callParams, globals);
 
         // ------ //
 
@@ -1345,13 +975,12 @@ Parser::Attributes Parser::CallParams(std::ostream& output, GlobalState& globals
 
     // Como CALLPARAM -> lambda, Follow (CALLPARAM)
     default: {
-        WriteParse(output, globals, 31);
+        WriteParse(globals, 31);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            callParams[aType] = tVoid;
-        }
+        if (globals.useSemantic)
+            RunAction(31, 1, callParams, globals);
 
         // ------ //
 
@@ -1359,17 +988,17 @@ Parser::Attributes Parser::CallParams(std::ostream& output, GlobalState& globals
     }
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(callParams);
 }
 
-Parser::Attributes Parser::NextParams(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::NextParams(GlobalState& globals) {
     const AttributesPosRef nextParams = CreateRuleAttributes();
 
     // NEXTPARAM -> , EXP1 NEXTPARAM | lambda
     switch (m_currentToken.type) {
     // First (EXP1 NEXTPARAM)
     case COMMA: {
-        WriteParse(output, globals, 32);
+        WriteParse(globals, 32);
 
         // ------ //
 
@@ -1377,21 +1006,14 @@ Parser::Attributes Parser::NextParams(std::ostream& output, GlobalState& globals
 
         // ------ //
 
-        const auto exp1 = Exp1(output, globals);
+        Exp1(globals);
 
         // ------ //
 
-        const auto nextParams_1 = NextParams(output, globals);
+        NextParams(globals);
 
-        if (globals.useSemantic) {
-            if (exp1.at(aType) == tError || nextParams_1.at(aType) == tError) {
-                nextParams[aType] = tError;
-            } else if (nextParams_1.at(aType) != tVoid) {
-                nextParams[aType] = exp1.at(aType) * nextParams_1.at(aType);
-            } else {
-                nextParams[aType] = exp1.at(aType);
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(32, 1, nextParams, globals);
 
         // ------ //
 
@@ -1400,13 +1022,12 @@ Parser::Attributes Parser::NextParams(std::ostream& output, GlobalState& globals
 
     // Como NEXTPARAM -> lambda, Follow (NEXTPARAM)
     default: {
-        WriteParse(output, globals, 33);
+        WriteParse(globals, 33);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            nextParams[aType] = tVoid;
-        }
+        if (globals.useSemantic)
+            RunAction(33, 1, nextParams, globals);
 
         // ------ //
 
@@ -1414,10 +1035,10 @@ Parser::Attributes Parser::NextParams(std::ostream& output, GlobalState& globals
     }
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(nextParams);
 }
 
-Parser::Attributes Parser::ReturnExp(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::ReturnExp(GlobalState& globals) {
     const AttributesPosRef returnExp = CreateRuleAttributes();
 
     // RETURNEXP -> EXP1 | lambda
@@ -1429,15 +1050,14 @@ Parser::Attributes Parser::ReturnExp(std::ostream& output, GlobalState& globals)
     case TRUE:
     case FALSE:
     case IDENTIFIER: {
-        WriteParse(output, globals, 34);
+        WriteParse(globals, 34);
 
         // ------ //
 
-        const auto exp1 = Exp1(output, globals);
+        Exp1(globals);
 
-        if (globals.useSemantic) {
-            returnExp[aType] = exp1.at(aType);
-        }
+        if (globals.useSemantic)
+            RunAction(34, 1, returnExp, globals);
 
         // ------ //
 
@@ -1446,13 +1066,12 @@ Parser::Attributes Parser::ReturnExp(std::ostream& output, GlobalState& globals)
 
     // Como RETURNEXP -> lambda, Follow (RETURNEXP)
     default: {
-        WriteParse(output, globals, 35);
+        WriteParse(globals, 35);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            returnExp[aType] = tVoid;
-        }
+        if (globals.useSemantic)
+            RunAction(35, 1, returnExp, globals);
 
         // ------ //
 
@@ -1460,10 +1079,10 @@ Parser::Attributes Parser::ReturnExp(std::ostream& output, GlobalState& globals)
     }
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(returnExp);
 }
 
-Parser::Attributes Parser::Exp1(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::Exp1(GlobalState& globals) {
     const AttributesPosRef exp1 = CreateRuleAttributes();
 
     // EXP1 -> EXP2 EXPOR
@@ -1475,39 +1094,18 @@ Parser::Attributes Parser::Exp1(std::ostream& output, GlobalState& globals) {
     case FALSE:
     case TRUE:
     case IDENTIFIER: {
-        WriteParse(output, globals, 36);
-
-        // ------ //
-
-        const auto exp2 = Exp2(output, globals);
-
-        // ------ //
-
-        const auto expOr = ExpOr(output, globals);
-
-        if (globals.useSemantic) {
-            if (expOr.at(aType) == tVoid) {
-                exp1[aType] = exp2.at(aType);
-            } else if (exp2.at(aType) == tError) {
-                exp1[aType] = tError;
-            } else if (exp2.at(aType) != tLog) {
-                exp1[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    exp2,
-                    SemanticError::INVALID_TYPE,
-                    std::format(
-                        "Para poder aplicar un operador lógico, la expresión debe ser de tipo «boolean». "
-                        "El tipo de la expresión es «{}».",
-                        exp2.at(aType).ToReadableString()
-                    )
-                );
-            } else if (expOr.at(aType) == tError) {
-                exp1[aType] = tError;
-            } else {
-                exp1[aType] = tLog;
-            }
-        }
+        WriteParse(globals, 36);
+
+        // ------ //
+
+        Exp2(globals);
+
+        // ------ //
+
+        ExpOr(globals);
+
+        if (globals.useSemantic)
+            RunAction(36, 1, exp1, globals);
 
         // ------ //
 
@@ -1518,17 +1116,17 @@ Parser::Attributes Parser::Exp1(std::ostream& output, GlobalState& globals) {
         ThrowSyntaxError(SyntaxError::EXP_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(exp1);
 }
 
-Parser::Attributes Parser::ExpOr(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::ExpOr(GlobalState& globals) {
     const AttributesPosRef expOr = CreateRuleAttributes();
 
     // EXPOR -> || EXP2 EXPOR | lambda
     switch (m_currentToken.type) {
     // First ( || EXP2 EXPOR )
     case OR: {
-        WriteParse(output, globals, 37);
+        WriteParse(globals, 37);
 
         // ------ //
 
@@ -1536,33 +1134,14 @@ Parser::Attributes Parser::ExpOr(std::ostream& output, GlobalState& globals) {
 
         // ------ //
 
-        const auto exp2 = Exp2(output, globals);
+        Exp2(globals);
 
         // ------ //
 
-        const auto expOr_1 = ExpOr(output, globals);
+        ExpOr(globals);
 
-        if (globals.useSemantic) {
-            if (exp2.at(aType) == tError) {
-                expOr[aType] = tError;
-            } else if (exp2.at(aType) != tLog) {
-                expOr[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    exp2,
-                    SemanticError::INVALID_TYPE,
-                    std::format(
-                        "Para poder aplicar un operador lógico, la expresión debe ser de tipo «boolean». "
-                        "El tipo de la expresión es «{}».",
-                        exp2.at(aType).ToReadableString()
-                    )
-                );
-            } else if (expOr_1.at(aType) == tError) {
-                expOr[aType] = tError;
-            } else {
-                expOr[aType] = tLog;
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(37, 1, expOr, globals);
 
         // ------ //
 
@@ -1571,13 +1150,12 @@ Parser::Attributes Parser::ExpOr(std::ostream& output, GlobalState& globals) {
 
     // Como EXPOR -> lambda, Follow (EXPOR)
     default: {
-        WriteParse(output, globals, 38);
+        WriteParse(globals, 38);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            expOr[aType] = tVoid;
-        }
+        if (globals.useSemantic)
+            RunAction(38, 1, expOr, globals);
 
         // ------ //
 
@@ -1585,10 +1163,10 @@ Parser::Attributes Parser::ExpOr(std::ostream& output, GlobalState& globals) {
     }
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(expOr);
 }
 
-Parser::Attributes Parser::Exp2(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::Exp2(GlobalState& globals) {
     const AttributesPosRef exp2 = CreateRuleAttributes();
 
     // EXP2 -> EXP3 EXPAND
@@ -1600,39 +1178,18 @@ Parser::Attributes Parser::Exp2(std::ostream& output, GlobalState& globals) {
     case FALSE:
     case TRUE:
     case IDENTIFIER: {
-        WriteParse(output, globals, 39);
-
-        // ------ //
-
-        const auto exp3 = Exp3(output, globals);
-
-        // ------ //
-
-        const auto expAnd = ExpAnd(output, globals);
-
-        if (globals.useSemantic) {
-            if (expAnd.at(aType) == tVoid) {
-                exp2[aType] = exp3.at(aType);
-            } else if (exp3.at(aType) == tError) {
-                exp2[aType] = tError;
-            } else if (exp3.at(aType) != tLog) {
-                exp2[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    exp3,
-                    SemanticError::INVALID_TYPE,
-                    std::format(
-                        "Para poder aplicar un operador lógico, la expresión debe ser de tipo «boolean». "
-                        "El tipo de la expresión es «{}».",
-                        exp3.at(aType).ToReadableString()
-                    )
-                );
-            } else if (expAnd.at(aType) == tError) {
-                exp2[aType] = tError;
-            } else {
-                exp2[aType] = tLog;
-            }
-        }
+        WriteParse(globals, 39);
+
+        // ------ //
+
+        Exp3(globals);
+
+        // ------ //
+
+        ExpAnd(globals);
+
+        if (globals.useSemantic)
+            RunAction(39, 1, exp2, globals);
 
         // ------ //
 
@@ -1643,17 +1200,17 @@ Parser::Attributes Parser::Exp2(std::ostream& output, GlobalState& globals) {
         ThrowSyntaxError(SyntaxError::EXP_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(exp2);
 }
 
-Parser::Attributes Parser::ExpAnd(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::ExpAnd(GlobalState& globals) {
     const AttributesPosRef expAnd = CreateRuleAttributes();
 
     // EXPAND -> && EXP3 EXPAND | lambda
     switch (m_currentToken.type) {
     // First ( && EXP3 EXPAND )
     case AND: {
-        WriteParse(output, globals, 40);
+        WriteParse(globals, 40);
 
         // ------ //
 
@@ -1661,33 +1218,14 @@ Parser::Attributes Parser::ExpAnd(std::ostream& output, GlobalState& globals) {
 
         // ------ //
 
-        const auto exp3 = Exp3(output, globals);
+        Exp3(globals);
 
         // ------ //
 
-        const auto expAnd_1 = ExpAnd(output, globals);
+        ExpAnd(globals);
 
-        if (globals.useSemantic) {
-            if (exp3.at(aType) == tError) {
-                expAnd[aType] = tError;
-            } else if (exp3.at(aType) != tLog) {
-                expAnd[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    exp3,
-                    SemanticError::INVALID_TYPE,
-                    std::format(
-                        "Para poder aplicar un operador lógico, la expresión debe ser de tipo «boolean». "
-                        "El tipo de la expresión es «{}».",
-                        exp3.at(aType).ToReadableString()
-                    )
-                );
-            } else if (expAnd_1.at(aType) == tError) {
-                expAnd[aType] = tError;
-            } else {
-                expAnd[aType] = tLog;
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(40, 1, expAnd, globals);
 
         // ------ //
 
@@ -1696,13 +1234,12 @@ Parser::Attributes Parser::ExpAnd(std::ostream& output, GlobalState& globals) {
 
     // Como EXPAND -> lambda, Follow (EXPAND)
     default: {
-        WriteParse(output, globals, 41);
+        WriteParse(globals, 41);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            expAnd[aType] = tVoid;
-        }
+        if (globals.useSemantic)
+            RunAction(41, 1, expAnd, globals);
 
         // ------ //
 
@@ -1710,10 +1247,10 @@ Parser::Attributes Parser::ExpAnd(std::ostream& output, GlobalState& globals) {
     }
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(expAnd);
 }
 
-Parser::Attributes Parser::Exp3(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::Exp3(GlobalState& globals) {
     const AttributesPosRef exp3 = CreateRuleAttributes();
 
     // EXP3 -> EXP4 COMP
@@ -1725,38 +1262,18 @@ Parser::Attributes Parser::Exp3(std::ostream& output, GlobalState& globals) {
     case FALSE:
     case TRUE:
     case IDENTIFIER: {
-        WriteParse(output, globals, 42);
+        WriteParse(globals, 42);
 
         // ------ //
 
-        const auto exp4 = Exp4(output, globals);
+        Exp4(globals);
 
         // ------ //
 
-        const auto comp = Comp(output, globals);
+        Comp(globals);
 
-        if (globals.useSemantic) {
-            if (comp.at(aType) == tVoid) {
-                exp3[aType] = exp4.at(aType);
-            } else if (exp4.at(aType) == tError) {
-                exp3[aType] = tError;
-            } else if (exp4.at(aType) != tInt) {
-                exp3[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    exp4,
-                    SemanticError::INVALID_TYPE,
-                    std::format(
-                        "Sólo se pueden comparar valores de tipo «int». El tipo actual es «{}».",
-                        exp4.at(aType).ToReadableString()
-                    )
-                );
-            } else if (comp.at(aType) == tError) {
-                exp3[aType] = tError;
-            } else {
-                exp3[aType] = tLog;
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(42, 1, exp3, globals);
 
         // ------ //
 
@@ -1767,10 +1284,10 @@ Parser::Attributes Parser::Exp3(std::ostream& output, GlobalState& globals) {
         ThrowSyntaxError(SyntaxError::EXP_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(exp3);
 }
 
-Parser::Attributes Parser::Comp(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::Comp(GlobalState& globals) {
     const AttributesPosRef comp = CreateRuleAttributes();
 
     // COMP -> COMPOP EXP4 COMP | lambda
@@ -1778,42 +1295,24 @@ Parser::Attributes Parser::Comp(std::ostream& output, GlobalState& globals) {
     // First (COMPOP EXP4 COMP)
     case GREATER:
     case LESS: {
-        WriteParse(output, globals, 43);
+        WriteParse(globals, 43);
 
         // ------ //
 
-        const auto compOp = CompOp(output, globals);
+        CompOp(globals);
 
         // ------ //
 
-        const auto exp4 = Exp4(output, globals);
+        Exp4(globals);
 
         // ------ //
 
-        const auto comp_1 = Comp(output, globals);
+        Comp(globals);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            if (exp4.at(aType) == tError) {
-                comp[aType] = tError;
-            } else if (exp4.at(aType) != tInt) {
-                comp[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    exp4,
-                    SemanticError::INVALID_TYPE,
-                    std::format(
-                        "Sólo se pueden comparar valores de tipo «int». El tipo actual es «{}».",
-                        exp4.at(aType).ToReadableString()
-                    )
-                );
-            } else if (comp_1.at(aType) == tError) {
-                comp[aType] = tError;
-            } else {
-                comp[aType] = tLog;
-            }
-        }
+        if (globals.useSemantic)
+            RunAction(43, 1, comp, globals);
 
         // ------ //
 
@@ -1822,13 +1321,12 @@ Parser::Attributes Parser::Comp(std::ostream& output, GlobalState& globals) {
 
     // Como COMP -> lambda, Follow (COMP)
     default: {
-        WriteParse(output, globals, 44);
+        WriteParse(globals, 44);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            comp[aType] = tVoid;
-        }
+        if (globals.useSemantic)
+            RunAction(44, 1, comp, globals);
 
         // ------ //
 
@@ -1836,17 +1334,17 @@ Parser::Attributes Parser::Comp(std::ostream& output, GlobalState& globals) {
     }
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(comp);
 }
 
-Parser::Attributes Parser::CompOp(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::CompOp(GlobalState& globals) {
     [[maybe_unused]] const AttributesPosRef parser = CreateRuleAttributes();
 
     // COMPOP -> > | <
     switch (m_currentToken.type) {
     // First (>)
     case GREATER: {
-        WriteParse(output, globals, 45);
+        WriteParse(globals, 45);
 
         // ------ //
 
@@ -1859,7 +1357,7 @@ Parser::Attributes Parser::CompOp(std::ostream& output, GlobalState& globals) {
 
     // First (<)
     case LESS: {
-        WriteParse(output, globals, 46);
+        WriteParse(globals, 46);
 
         // ------ //
 
@@ -1874,10 +1372,10 @@ Parser::Attributes Parser::CompOp(std::ostream& output, GlobalState& globals) {
         ThrowSyntaxError(SyntaxError::COMP_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(parser);
 }
 
-Parser::Attributes Parser::Exp4(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::Exp4(GlobalState& globals) {
     const AttributesPosRef exp4 = CreateRuleAttributes();
 
     // EXP4 -> EXPATOM ARITH
@@ -1889,49 +1387,18 @@ Parser::Attributes Parser::Exp4(std::ostream& output, GlobalState& globals) {
     case FALSE:
     case TRUE:
     case IDENTIFIER: {
-        WriteParse(output, globals, 47);
-
-        // ------ //
-
-        const auto expAtom = ExpAtom(output, globals);
-
-        // ------ //
-
-        const auto arith = Arith(output, globals);
-
-        if (globals.useSemantic) {
-            if (arith.at(aType) == tVoid) {
-                exp4[aType] = expAtom.at(aType);
-            } else if (expAtom.at(aType) != tInt && expAtom.at(aType) != tStr) {
-                exp4[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    expAtom,
-                    SemanticError::INVALID_TYPE,
-                    std::format(
-                        "Una operación aritmética requiere que el tipo sea «int» o «string»."
-                        " El tipo actual es «{}».",
-                        expAtom.at(aType).ToReadableString()
-                    )
-                );
-            } else if (arith.at(aType) == tError) {
-                exp4[aType] = tError;
-            } else if (expAtom.at(aType) != arith.at(aType)) {
-                exp4[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    exp4,
-                    SemanticError::INCOHERENT_TYPES,
-                    std::format(
-                        "Los tipos no concuerdan. Los tipos de las expresiones son «{}» y «{}».",
-                        expAtom.at(aType).ToReadableString(),
-                        arith.at(aType).ToReadableString()
-                    )
-                );
-            } else {
-                exp4[aType] = arith.at(aType);
-            }
-        }
+        WriteParse(globals, 47);
+
+        // ------ //
+
+        ExpAtom(globals);
+
+        // ------ //
+
+        Arith(globals);
+
+        if (globals.useSemantic)
+            RunAction(47, 1, exp4, globals);
 
         // ------ //
 
@@ -1942,10 +1409,10 @@ Parser::Attributes Parser::Exp4(std::ostream& output, GlobalState& globals) {
         ThrowSyntaxError(SyntaxError::EXP_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(exp4);
 }
 
-Parser::Attributes Parser::Arith(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::Arith(GlobalState& globals) {
     const AttributesPosRef arith = CreateRuleAttributes();
 
     // ARITH -> ARITHOP EXPATOM ARITH | lambda
@@ -1953,64 +1420,22 @@ Parser::Attributes Parser::Arith(std::ostream& output, GlobalState& globals) {
     // First (ARITHOP EXPATOM ARITH)
     case SUM:
     case SUB: {
-        WriteParse(output, globals, 48);
-
-        // ------ //
-
-        const auto arithOp = ArithOp(output, globals);
-
-        // ------ //
-
-        const auto expAtom = ExpAtom(output, globals);
-
-        // ------ //
-
-        const auto arith_1 = Arith(output, globals);
-
-        if (globals.useSemantic) {
-            if (!arithOp.at(aSum) && expAtom.at(aType) != tInt) {
-                arith[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    expAtom,
-                    SemanticError::INVALID_TYPE,
-                    std::format(
-                        "La resta sólo se puede realizar sobre expresiones de "
-                        "tipo «int», pero el tipo de la expresión es «{}».",
-                        expAtom.at(aType).ToReadableString()
-                    )
-                );
-            } else if (arithOp.at(aSum) && expAtom.at(aType) != tInt && expAtom.at(aType) != tStr) {
-                arith[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    expAtom,
-                    SemanticError::INVALID_TYPE,
-                    std::format(
-                        "El operador «+» sólo se puede aplicar a expresiones de tipo "
-                        "«int» o «string», pero el tipo de la expresión es «{}».",
-                        expAtom.at(aType).ToReadableString()
-                    )
-                );
-            } else if (arith_1.at(aType) == tError) {
-                arith[aType] = tError;
-            } else if (arith_1.at(aType) != tVoid && expAtom.at(aType) != arith_1.at(aType)) {
-                arith[aType] = tError;
-                LogSemanticError(
-                    globals,
-                    expAtom,
-                    arith_1,
-                    SemanticError::INCOHERENT_TYPES,
-                    std::format(
-                        "Los tipos no concuerdan. Los tipos de las expresiones son «{}» y «{}».",
-                        expAtom.at(aType).ToReadableString(),
-                        arith_1.at(aType).ToReadableString()
-                    )
-                );
-            } else {
-                arith[aType] = expAtom.at(aType);
-            }
-        }
+        WriteParse(globals, 48);
+
+        // ------ //
+
+        ArithOp(globals);
+
+        // ------ //
+
+        ExpAtom(globals);
+
+        // ------ //
+
+        Arith(globals);
+
+        if (globals.useSemantic)
+            RunAction(48, 1, arith, globals);
 
         // ------ //
 
@@ -2020,13 +1445,12 @@ Parser::Attributes Parser::Arith(std::ostream& output, GlobalState& globals) {
 
     // Como ARITH -> lambda, Follow (ARITH)
     default: {
-        WriteParse(output, globals, 49);
+        WriteParse(globals, 49);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            arith[aType] = tVoid;
-        }
+        if (globals.useSemantic)
+            RunAction(49, 1, arith, globals);
 
         // ------ //
 
@@ -2034,23 +1458,22 @@ Parser::Attributes Parser::Arith(std::ostream& output, GlobalState& globals) {
     }
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(arith);
 }
 
-Parser::Attributes Parser::ArithOp(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::ArithOp(GlobalState& globals) {
     const AttributesPosRef arithOp = CreateRuleAttributes();
 
     // ARITHOP -> + | -
     switch (m_currentToken.type) {
     // First (+)
     case SUM: {
-        WriteParse(output, globals, 50);
+        WriteParse(globals, 50);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            arithOp[aSum] = true;
-        }
+        if (globals.useSemantic)
+            RunAction(50, 1, arithOp, globals);
 
         GetNextToken(globals);
 
@@ -2061,13 +1484,12 @@ Parser::Attributes Parser::ArithOp(std::ostream& output, GlobalState& globals) {
 
     // First (-)
     case SUB: {
-        WriteParse(output, globals, 51);
+        WriteParse(globals, 51);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            arithOp[aSum] = false;
-        }
+        if (globals.useSemantic)
+            RunAction(51, 1, arithOp, globals);
 
         GetNextToken(globals);
 
@@ -2080,17 +1502,17 @@ Parser::Attributes Parser::ArithOp(std::ostream& output, GlobalState& globals) {
         ThrowSyntaxError(SyntaxError::ARITH_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(arithOp);
 }
 
-Parser::Attributes Parser::ExpAtom(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::ExpAtom(GlobalState& globals) {
     const AttributesPosRef expAtom = CreateRuleAttributes();
 
     // EXPATOM -> id IDVAL | ( EXP1 ) | cint | cstr | true | false
     switch (m_currentToken.type) {
     // First (id IDVAL)
     case IDENTIFIER: {
-        WriteParse(output, globals, 52);
+        WriteParse(globals, 52);
 
         // ------ //
 
@@ -2100,54 +1522,10 @@ Parser::Attributes Parser::ExpAtom(std::ostream& output, GlobalState& globals) {
 
         // ------ //
 
-        const auto idVal = IdVal(output, globals);
-
-        if (globals.useSemantic) {
-            const auto& pos = std::get<SymbolPos>(id.attribute);
-            const auto type = globals.GetType(pos);
-
-            if (idVal.at(aFunCall)) {
-                if (!IsFunction(type)) {
-                    expAtom[aType] = tError;
-                    LogSemanticError(
-                        globals,
-                        expAtom,
-                        SemanticError::INCOHERENT_VARIABLE_AS_FUNCTION_TYPES,
-                        "No se puede llamar a una variable como si fuera una función."
-                    );
-                } else if (idVal.at(aType) == tError) {
-                    expAtom[aType] = tError;
-                } else if (idVal.at(aType) == GetFunctionArgsType(type)) {
-                    expAtom[aType] = GetFunctionReturnType(type);
-                } else {
-                    expAtom[aType] = tError;
-                    LogSemanticError(
-                        globals,
-                        idVal,
-                        SemanticError::INCOHERENT_CALL_PARAM_TYPES,
-                        std::format(
-                            "Los tipos de los argumentos de llamada a la función no "
-                            "coinciden con los de la definición. Se esperaba «{}», "
-                            "pero se recibió «{}».",
-                            GetFunctionArgsType(type).ToReadableString(),
-                            idVal.at(aType).ToReadableString()
-                        )
-                    );
-                }
-            } else {
-                if (IsFunction(type)) {
-                    expAtom[aType] = tError;
-                    LogSemanticError(
-                        globals,
-                        idVal,
-                        SemanticError::INCOHERENT_FUNCTION_AS_VARIABLE_TYPES,
-                        "No se puede asignar valores a una función."
-                    );
-                } else {
-                    expAtom[aType] = type;
-                }
-            }
-        }
+        IdVal(globals);
+
+        if (globals.useSemantic)
+            RunAction(52, 1, expAtom, globals, id);
 
         // ------ //
 
@@ -2156,7 +1534,7 @@ Parser::Attributes Parser::ExpAtom(std::ostream& output, GlobalState& globals) {
 
     // First (( EXP1 ))
     case PARENTHESIS_OPEN: {
-        WriteParse(output, globals, 53);
+        WriteParse(globals, 53);
 
         // ------ //
 
@@ -2164,11 +1542,10 @@ Parser::Attributes Parser::ExpAtom(std::ostream& output, GlobalState& globals) {
 
         // ------ //
 
-        const auto exp1 = Exp1(output, globals);
+        Exp1(globals);
 
-        if (globals.useSemantic) {
-            expAtom[aType] = exp1.at(aType);
-        }
+        if (globals.useSemantic)
+            RunAction(53, 1, expAtom, globals);
 
         // ------ //
 
@@ -2183,13 +1560,12 @@ Parser::Attributes Parser::ExpAtom(std::ostream& output, GlobalState& globals) {
 
     // First (cint)
     case CINT: {
-        WriteParse(output, globals, 54);
+        WriteParse(globals, 54);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            expAtom[aType] = tInt;
-        }
+        if (globals.useSemantic)
+            RunAction(54, 1, expAtom, globals);
 
         GetNextToken(globals);
 
@@ -2200,13 +1576,12 @@ Parser::Attributes Parser::ExpAtom(std::ostream& output, GlobalState& globals) {
 
     // First (cstr)
     case CSTR: {
-        WriteParse(output, globals, 55);
+        WriteParse(globals, 55);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            expAtom[aType] = tStr;
-        }
+        if (globals.useSemantic)
+            RunAction(55, 1, expAtom, globals);
 
         GetNextToken(globals);
 
@@ -2217,13 +1592,12 @@ Parser::Attributes Parser::ExpAtom(std::ostream& output, GlobalState& globals) {
 
     // First (true)
     case TRUE: {
-        WriteParse(output, globals, 56);
+        WriteParse(globals, 56);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            expAtom[aType] = tLog;
-        }
+        if (globals.useSemantic)
+            RunAction(56, 1, expAtom, globals);
 
         GetNextToken(globals);
 
@@ -2234,13 +1608,12 @@ Parser::Attributes Parser::ExpAtom(std::ostream& output, GlobalState& globals) {
 
     // First (false)
     case FALSE: {
-        WriteParse(output, globals, 57);
+        WriteParse(globals, 57);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            expAtom[aType] = tLog;
-        }
+        if (globals.useSemantic)
+            RunAction(57, 1, expAtom, globals);
 
         GetNextToken(globals);
 
@@ -2253,17 +1626,17 @@ Parser::Attributes Parser::ExpAtom(std::ostream& output, GlobalState& globals) {
         ThrowSyntaxError(SyntaxError::EXP_INVALID);
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(expAtom);
 }
 
-Parser::Attributes Parser::IdVal(std::ostream& output, GlobalState& globals) {
+Parser::AttributesPosRef Parser::IdVal(GlobalState& globals) {
     const AttributesPosRef idVal = CreateRuleAttributes();
 
     // IDVAL -> ( CALLPARAM ) | lambda
     switch (m_currentToken.type) {
     // First (( CALLPARAM ))
     case PARENTHESIS_OPEN: {
-        WriteParse(output, globals, 58);
+        WriteParse(globals, 58);
 
         // ------ //
 
@@ -2271,12 +1644,10 @@ Parser::Attributes Parser::IdVal(std::ostream& output, GlobalState& globals) {
 
         // ------ //
 
-        const auto callParams = CallParams(output, globals);
+        CallParams(globals);
 
-        if (globals.useSemantic) {
-            idVal[aFunCall] = true;
-            idVal[aType] = callParams.at(aType);
-        }
+        if (globals.useSemantic)
+            RunAction(58, 1, idVal, globals);
 
         // ------ //
 
@@ -2291,14 +1662,12 @@ Parser::Attributes Parser::IdVal(std::ostream& output, GlobalState& globals) {
 
     // Como IDVAL -> lambda, Follow (IDVAL)
     default: {
-        WriteParse(output, globals, 59);
+        WriteParse(globals, 59);
 
         // ------ //
 
-        if (globals.useSemantic) {
-            idVal[aFunCall] = false;
-            idVal[aType] = tVoid; // TODO: esto es asi?? (faltaba inicializar este valor)
-        }
+        if (globals.useSemantic)
+            RunAction(59, 1, idVal, globals);
 
         // ------ //
 
@@ -2306,10 +1675,10 @@ Parser::Attributes Parser::IdVal(std::ostream& output, GlobalState& globals) {
     }
     }
 
-    return PopCurrentAttributes();
+    return CloseRuleAttributes(idVal);
 }
 
-void Parser::Parse(std::ostream& output, GlobalState& globals) {
+void Parser::Parse(GlobalState& globals) {
     try {
         globals.errorManager.SetLexicalRecoveryMode(LexicalRecoveryMode::SkipChar);
 
@@ -2320,7 +1689,9 @@ void Parser::Parse(std::ostream& output, GlobalState& globals) {
 
         GetNextToken(globals);
 
-        const auto axiom = Axiom(output, globals);
+        const Attributes& axiom = globals.parserOptions.tableDriven
+                                      ? ParseWithTable(globals)
+                                      : Axiom(globals);
         if (globals.useSemantic && axiom.at(aType) == tError) {
             assert(globals.errorManager.GetStatus() != 0);
             globals.errorManager.LogError("Hay errores semánticos al procesar el programa.");
@@ -1,56 +1,111 @@
 #pragma once
 
 #include "language/process/Lexer.h"
+#include "language/process/ParserTable.h"
 #include "language/errors/SyntaxError.h"
 #include "language/core/ValueProduct.h"
 
+#include <array>
+#include <cstdint>
 #include <sstream>
 
 class Parser {
-    struct Attributes : std::map<std::string, ValueProduct> {
-        unsigned startLine;
-        unsigned startColumn;
-        unsigned endLine;
-        unsigned endColumn;
+    /** Los atributos semánticos de las reglas. **/
+    enum Attribute : unsigned char {
+        aType,
+        aValueType,
+        aWidth,
+        aSum,
+        aFunCall,
+        ATTRIBUTE_COUNT
+    };
+
+    /**
+     * Los atributos de una regla, cada uno en su casilla. Los que la regla
+     * no asigna quedan vacíos. El final de la regla es el del último token
+     * que consume, o el del token actual si todavía no ha consumido ninguno;
+     * se actualiza al consultarlo (véase UpdateSpan).
+     */
+    struct Attributes {
+        std::array<ValueProduct, ATTRIBUTE_COUNT> values;
+        size_t startOffset;
+        size_t endOffset;
+
+        /** Los tokens consumidos al empezar la regla. **/
+        size_t firstToken;
+
+        /** Si la regla ya ha terminado, y con ella su final. **/
+        bool isClosed = false;
 
         Attributes(
-            unsigned startLine,
-            unsigned startColumn,
-            unsigned endLine,
-            unsigned endColumn
-        ) : startLine(startLine),
-            startColumn(startColumn),
-            endLine(endLine),
-            endColumn(endColumn) {}
+            size_t startOffset,
+            size_t endOffset,
+            size_t firstToken
+        ) : startOffset(startOffset),
+            endOffset(endOffset),
+            firstToken(firstToken) {}
+
+        [[nodiscard]] ValueProduct& operator[](const Attribute key) {
+            return values[key];
+        }
+
+        [[nodiscard]] const ValueProduct& at(const Attribute key) const {
+            assert(!values[key].IsEmpty());
+            return values[key];
+        }
     };
 
     struct AttributesPosRef {
         size_t pos;
-        std::vector<Attributes>* vec;
+        Parser* parser;
 
         operator const Attributes&() const {
-            return (*vec)[pos];
+            Attributes& attributes = parser->m_attributesStack[pos];
+            parser->UpdateSpan(attributes);
+            return attributes;
         }
 
-        [[nodiscard]] ValueProduct& operator[](const std::string& key) const {
-            return (*vec)[pos][key];
+        [[nodiscard]] ValueProduct& operator[](const Attribute key) const {
+            return parser->m_attributesStack[pos][key];
         }
 
-        [[nodiscard]] ValueProduct& operator[](std::string&& key) const {
-            return (*vec)[pos][key];
+        [[nodiscard]] const ValueProduct& at(const Attribute key) const {
+            return parser->m_attributesStack[pos].at(key);
         }
+    };
 
-        [[nodiscard]] const ValueProduct& at(const std::string& key) const {
-            return (*vec)[pos].at(key);
-        }
+    /** Una producción en curso del analizador por tabla. **/
+    struct Frame {
+        /** El siguiente paso a ejecutar en ParserTable::STEPS. **/
+        uint16_t step;
+        uint8_t production;
+
+        /** Sus atributos, con los de sus no terminales ya analizados encima. **/
+        AttributesPosRef attributes;
+
+        /** El último identificador comprobado, si la producción tiene alguno. **/
+        Token id;
     };
 
     Lexer m_lexer;
 
     Token m_currentToken;
 
+    /**
+     * Los atributos de las reglas en curso. Encima de los de cada regla
+     * están los de sus no terminales ya analizados, en orden.
+     */
     std::vector<Attributes> m_attributesStack;
 
+    /** La pila de producciones del analizador por tabla. **/
+    std::vector<Frame> m_frames;
+
+    /** Los tokens consumidos hasta ahora. **/
+    size_t m_consumedTokens = 0;
+
+    /** La posición del final del último token consumido. **/
+    size_t m_lastTokenEnd = 0;
+
     [[noreturn]]
     void ThrowSyntaxError(SyntaxError error) const {
         throw SyntaxException(error, m_currentToken);
@@ -58,26 +113,27 @@ class Parser {
 
     void LogSemanticError(
         GlobalState& globals,
-        unsigned startLine,
-        unsigned startColumn,
-        unsigned endColumn,
-        SemanticError error,
-        std::string_view message
+        size_t startOffset,
+        size_t endOffset,
+        const SemanticDiagnostic& diagnostic
     ) const {
-        if (m_currentToken.line == startLine) {
+        const auto [startLine, startColumn] = m_lexer.Locate(startOffset);
+
+        if (m_lexer.Locate(m_currentToken.offset).line == startLine) {
+            const unsigned endColumn = m_lexer.Locate(endOffset).column;
             assert(endColumn >= startColumn);
             globals.errorManager.LogSemanticError(
                 m_lexer.GetCurrentLine(),
                 startLine, startColumn,
                 endColumn - startColumn,
-                error, message
+                diagnostic
             );
         } else {
             globals.errorManager.LogSemanticError(
                 m_lexer.GetCurrentLine(),
                 startLine, startColumn,
                 0,
-                error, message
+                diagnostic
             );
         }
     }
@@ -85,15 +141,13 @@ class Parser {
     void LogSemanticError(
         GlobalState& globals,
         const Attributes& attributes,
-        SemanticError error,
-        std::string_view message
+        const SemanticDiagnostic& diagnostic
     ) const {
         LogSemanticError(
             globals,
-            attributes.startLine,
-            attributes.startColumn,
-            attributes.endColumn,
-            error, message
+            attributes.startOffset,
+            attributes.endOffset,
+            diagnostic
         );
     }
 
@@ -102,30 +156,26 @@ class Parser {
         GlobalState& globals,
         const Attributes& startAttributes,
         const Attributes& endAttributes,
-        SemanticError error,
-        std::string_view message
+        const SemanticDiagnostic& diagnostic
     ) const {
         LogSemanticError(
             globals,
-            startAttributes.startLine,
-            startAttributes.startColumn,
-            endAttributes.endColumn,
-            error, message
+            startAttributes.startOffset,
+            endAttributes.endOffset,
+            diagnostic
         );
     }
 
     void LogSemanticError(
         GlobalState& globals,
         const Token& token,
-        SemanticError error,
-        std::string_view message
+        const SemanticDiagnostic& diagnostic
     ) const {
         LogSemanticError(
             globals,
-            token.line,
-            token.column,
-            token.column + token.length,
-            error, message
+            token.offset,
+            token.offset + token.length,
+            diagnostic
         );
     }
 
@@ -134,34 +184,55 @@ class Parser {
         LogSemanticError(
             globals,
             m_currentToken,
-            {},
-            message
+            SemanticDiagnostic({}, "{}", message)
         );
     }
 
 
     AttributesPosRef CreateRuleAttributes() {
         m_attributesStack.emplace_back(
-            m_currentToken.line,
-            m_currentToken.column,
-            m_currentToken.line,
-            m_currentToken.column + m_currentToken.length
+            m_currentToken.offset,
+            m_currentToken.offset + m_currentToken.length,
+            m_consumedTokens
         );
-        return { m_attributesStack.size() - 1, &m_attributesStack };
+        return { m_attributesStack.size() - 1, this };
     }
 
-    Attributes PopCurrentAttributes() {
-        Attributes attributes = std::move(m_attributesStack.back());
-        m_attributesStack.pop_back();
-        return attributes;
+    /** Lleva el final de una regla en curso al del último token que ha consumido. **/
+    void UpdateSpan(Attributes& attributes) const {
+        if (!attributes.isClosed && m_consumedTokens != attributes.firstToken)
+            attributes.endOffset = m_lastTokenEnd;
+    }
+
+    /**
+     * Termina una regla. Sus atributos se quedan en la pila, donde los lee
+     * la regla que la contiene, y se descartan los de sus no terminales, que
+     * están encima. Así las reglas no copian sus atributos al devolverlos.
+     */
+    AttributesPosRef CloseRuleAttributes(const AttributesPosRef self) {
+        assert(self.pos < m_attributesStack.size());
+
+        Attributes& attributes = m_attributesStack[self.pos];
+        UpdateSpan(attributes);
+        attributes.isClosed = true;
+
+        m_attributesStack.erase(
+            m_attributesStack.begin() + static_cast<ptrdiff_t>(self.pos + 1),
+            m_attributesStack.end()
+        );
+
+        return self;
     }
 
 
     void GetNextToken(GlobalState& globals) {
-        for (Attributes& attributes : m_attributesStack) {
-            attributes.endLine = m_currentToken.line;
-            attributes.endColumn = m_currentToken.column + m_currentToken.length;
-        }
+        m_lastTokenEnd = m_currentToken.offset + m_currentToken.length;
+        m_consumedTokens += 1;
+
+        // Los errores semánticos se sitúan desde el inicio de alguna regla en
+        // curso. La pila está ordenada por inicio: la primera es la más antigua.
+        if (!m_attributesStack.empty())
+            m_lexer.KeepLocatable(m_attributesStack.front().startOffset);
 
         m_currentToken = m_lexer.GetToken(globals);
     }
@@ -172,62 +243,106 @@ class Parser {
     }
 
 
-    [[nodiscard]] Attributes Axiom(std::ostream& output, GlobalState& globals);
+    static void WriteParse(GlobalState& globals, int transition);
+
+    static void WriteCurrentTable(GlobalState& globals);
+
+    [[nodiscard]] static bool IsFunction(const ValueProduct& type);
+
+    [[nodiscard]] static ValueProduct GetFunctionReturnType(const ValueProduct& type);
+
+    [[nodiscard]] static ValueProduct GetFunctionArgsType(const ValueProduct& type);
+
+
+    /**
+     * Elige la producción de un no terminal según el token actual y la
+     * apila, o lanza el error sintáctico del no terminal si no hay ninguna.
+     */
+    void PushRule(NonTerminal rule, GlobalState& globals);
+
+    /** Los atributos del i-ésimo no terminal ya analizado de una regla. **/
+    [[nodiscard]] const Attributes& GetChild(const AttributesPosRef self, const size_t i) const {
+        assert(self.pos + 1 + i < m_attributesStack.size());
+        const Attributes& child = m_attributesStack[self.pos + 1 + i];
+        assert(child.isClosed);
+        return child;
+    }
+
+    /**
+     * Ejecuta una acción semántica de una producción (véase ParserActions.cpp).
+     * La llaman tanto los procedimientos recursivos como el analizador por tabla.
+     * @param production El número de la producción.
+     * @param action El número de la acción dentro de la producción, desde 1,
+     *               en el orden de ParserTable::STEPS.
+     * @param self Los atributos de la regla.
+     * @param id El último identificador comprobado, si la producción tiene alguno.
+     */
+    void RunAction(uint8_t production, unsigned action, AttributesPosRef self, GlobalState& globals, const Token& id = {});
+
+    /**
+     * Analiza el programa con la tabla LL(1) y una pila explícita en lugar
+     * de recursivamente. La traza y los errores son los mismos que los de
+     * Axiom, que se mantiene como referencia.
+     */
+    AttributesPosRef ParseWithTable(GlobalState& globals);
+
+
+    AttributesPosRef Axiom(GlobalState& globals);
 
-    [[nodiscard]] Attributes Function(std::ostream& output, GlobalState& globals);
+    AttributesPosRef Function(GlobalState& globals);
 
-    [[nodiscard]] Attributes FunType(std::ostream& output, GlobalState& globals);
+    AttributesPosRef FunType(GlobalState& globals);
 
-    [[nodiscard]] Attributes VarType(std::ostream& output, GlobalState& globals);
+    AttributesPosRef VarType(GlobalState& globals);
 
-    [[nodiscard]] Attributes FunAttributes(std::ostream& output, GlobalState& globals);
+    AttributesPosRef FunAttributes(GlobalState& globals);
 
-    [[nodiscard]] Attributes NextAttributes(std::ostream& output, GlobalState& globals);
+    AttributesPosRef NextAttributes(GlobalState& globals);
 
-    [[nodiscard]] Attributes Body(std::ostream& output, GlobalState& globals);
+    AttributesPosRef Body(GlobalState& globals);
 
-    [[nodiscard]] Attributes Statement(std::ostream& output, GlobalState& globals);
+    AttributesPosRef Statement(GlobalState& globals);
 
-    [[nodiscard]] Attributes AtomStatement(std::ostream& output, GlobalState& globals);
+    AttributesPosRef AtomStatement(GlobalState& globals);
 
-    [[nodiscard]] Attributes IdAct(std::ostream& output, GlobalState& globals);
+    AttributesPosRef IdAct(GlobalState& globals);
 
-    [[nodiscard]] Attributes ForAct(std::ostream& output, GlobalState& globals);
+    AttributesPosRef ForAct(GlobalState& globals);
 
-    [[nodiscard]] Attributes Ass(std::ostream& output, GlobalState& globals);
+    AttributesPosRef Ass(GlobalState& globals);
 
-    [[nodiscard]] Attributes CallParams(std::ostream& output, GlobalState& globals);
+    AttributesPosRef CallParams(GlobalState& globals);
 
-    [[nodiscard]] Attributes NextParams(std::ostream& output, GlobalState& globals);
+    AttributesPosRef NextParams(GlobalState& globals);
 
-    [[nodiscard]] Attributes ReturnExp(std::ostream& output, GlobalState& globals);
+    AttributesPosRef ReturnExp(GlobalState& globals);
 
-    [[nodiscard]] Attributes Exp1(std::ostream& output, GlobalState& globals);
+    AttributesPosRef Exp1(GlobalState& globals);
 
-    [[nodiscard]] Attributes ExpOr(std::ostream& output, GlobalState& globals);
+    AttributesPosRef ExpOr(GlobalState& globals);
 
-    [[nodiscard]] Attributes Exp2(std::ostream& output, GlobalState& globals);
+    AttributesPosRef Exp2(GlobalState& globals);
 
-    [[nodiscard]] Attributes ExpAnd(std::ostream& output, GlobalState& globals);
+    AttributesPosRef ExpAnd(GlobalState& globals);
 
-    [[nodiscard]] Attributes Exp3(std::ostream& output, GlobalState& globals);
+    AttributesPosRef Exp3(GlobalState& globals);
 
-    [[nodiscard]] Attributes Comp(std::ostream& output, GlobalState& globals);
+    AttributesPosRef Comp(GlobalState& globals);
 
-    [[nodiscard]] Attributes CompOp(std::ostream& output, GlobalState& globals);
+    AttributesPosRef CompOp(GlobalState& globals);
 
-    [[nodiscard]] Attributes Exp4(std::ostream& output, GlobalState& globals);
+    AttributesPosRef Exp4(GlobalState& globals);
 
-    [[nodiscard]] Attributes Arith(std::ostream& output, GlobalState& globals);
+    AttributesPosRef Arith(GlobalState& globals);
 
-    [[nodiscard]] Attributes ArithOp(std::ostream& output, GlobalState& globals);
+    AttributesPosRef ArithOp(GlobalState& globals);
 
-    [[nodiscard]] Attributes ExpAtom(std::ostream& output, GlobalState& globals);
+    AttributesPosRef ExpAtom(GlobalState& globals);
 
-    [[nodiscard]] Attributes IdVal(std::ostream& output, GlobalState& globals);
+    AttributesPosRef IdVal(GlobalState& globals);
 
 public:
-    explicit Parser(std::istream& input) : m_lexer(input), m_currentToken() {}
+    explicit Parser(Source& source) : m_lexer(source), m_currentToken() {}
 
-    void Parse(std::ostream& output, GlobalState& globals);
+    void Parse(GlobalState& globals);
 };
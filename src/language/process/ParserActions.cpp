@@ -0,0 +1,1206 @@
+#include "Parser.h"
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "bugprone-branch-clone"
+
+// Las acciones semánticas de cada producción, que comparten el analizador
+// recursivo y el analizador por tabla. Cada producción numera sus acciones
+// desde 1, en el orden de ParserTable::STEPS.
+
+void Parser::RunAction(
+    const uint8_t production,
+    const unsigned action,
+    const AttributesPosRef self,
+    GlobalState& globals,
+    const Token& id
+) {
+    switch (production) {
+    // P -> FUNCTION P
+    case 1: {
+        const AttributesPosRef axiom = self;
+        const Attributes& function = GetChild(self, 0);
+        const Attributes& axiom_1 = GetChild(self, 1);
+
+        if (function.at(aType) == tError || axiom_1.at(aType) == tError) {
+            axiom[aType] = tError;
+        } else {
+            axiom[aType] = tOk;
+        }
+        break;
+    }
+
+    // P -> STATEMENT P
+    case 2: {
+        const AttributesPosRef axiom = self;
+        const Attributes& statement = GetChild(self, 0);
+        const Attributes& axiom_1 = GetChild(self, 1);
+
+        if (statement.at(aType) == tError || axiom_1.at(aType) == tError) {
+            axiom[aType] = tError;
+        } else {
+            axiom[aType] = tOk;
+        }
+        break;
+    }
+
+    // P -> eof
+    case 3: {
+        const AttributesPosRef axiom = self;
+
+        axiom[aType] = tOk;
+        break;
+    }
+
+    // FUNCTION -> function FUNTYPE id ( FUNATTRIBUTES ) { BODY }
+    case 4:
+        switch (action) {
+        case 1:
+            globals.implicitDeclaration = false;
+            break;
+
+        case 2:
+            globals.localTable = SymbolTable(globals.tableCounter);
+            globals.tableCounter += 1;
+            globals.localOffset = 0;
+            break;
+
+        case 3: {
+            const AttributesPosRef function = self;
+            const Attributes& funType = GetChild(self, 0);
+            const Attributes& funAttributes = GetChild(self, 1);
+
+            const SymbolPos pos = id.GetSymbol();
+
+            if (globals.HasType(pos)) {
+                function[aType] = tError;
+                LogSemanticError(
+                    globals,
+                    id,
+                    SemanticDiagnostic(
+                        SemanticError::IDENTIFIER_ALREADY_EXISTS,
+                        "El nombre de la función ya está en uso."
+                    )
+                );
+            } else {
+                function[aType] = funAttributes.at(aType);
+                globals.AddFunctionType(pos, funType.at(aType), funAttributes.at(aValueType));
+                globals.AddFunctionTag(pos);
+            }
+
+            globals.implicitDeclaration = true;
+            break;
+        }
+
+        case 4: {
+            const AttributesPosRef function = self;
+            const Attributes& funType = GetChild(self, 0);
+            const Attributes& body = GetChild(self, 2);
+
+            if (funType.at(aType) != body.at(aValueType)) {
+                function[aType] = tError;
+
+                const SymbolPos pos = id.GetSymbol();
+                LogSemanticError(
+                    globals,
+                    funType,
+                    SemanticDiagnostic(
+                        SemanticError::INVALID_RETURN_TYPE,
+                        "El tipo de retorno de la función «{}» («{}») no coincide con el "
+                        "devuelto («{}»).",
+                        globals.GetSymbolName(pos),
+                        funType.at(aType),
+                        body.at(aValueType)
+                    )
+                );
+            }
+
+            WriteCurrentTable(globals);
+            globals.localTable = std::nullopt;
+            break;
+        }
+        }
+        break;
+
+    // FUNTYPE -> void
+    case 5: {
+        const AttributesPosRef funType = self;
+
+        funType[aType] = tVoid;
+        break;
+    }
+
+    // FUNTYPE -> VARTYPE
+    case 6: {
+        const AttributesPosRef funType = self;
+        const Attributes& varType = GetChild(self, 0);
+
+        funType[aType] = varType.at(aType);
+        break;
+    }
+
+    // VARTYPE -> int
+    case 7: {
+        const AttributesPosRef varType = self;
+
+        varType[aType] = tInt;
+        varType[aWidth] = wInt;
+        break;
+    }
+
+    // VARTYPE -> boolean
+    case 8: {
+        const AttributesPosRef varType = self;
+
+        varType[aType] = tLog;
+        varType[aWidth] = wLog;
+        break;
+    }
+
+    // VARTYPE -> string
+    case 9: {
+        const AttributesPosRef varType = self;
+
+        varType[aType] = tStr;
+        varType[aWidth] = wStr;
+        break;
+    }
+
+    // FUNATTRIBUTES -> void
+    case 10: {
+        const AttributesPosRef funAttributes = self;
+
+        funAttributes[aType] = tOk;
+        funAttributes[aValueType] = tVoid;
+        break;
+    }
+
+    // FUNATTRIBUTES -> VARTYPE id NEXTATTRIBUTE
+    case 11:
+        switch (action) {
+        case 1: {
+            const AttributesPosRef funAttributes = self;
+            const Attributes& varType = GetChild(self, 0);
+
+            const SymbolPos pos = id.GetSymbol();
+
+            if (globals.HasType(pos)) {
+                funAttributes[aType] = tError;
+                LogSemanticError(
+                    globals,
+                    id,
+                    SemanticDiagnostic(
+                        SemanticError::IDENTIFIER_ALREADY_EXISTS,
+                        "El nombre de este atributo ya está en uso."
+                    )
+                );
+            } else {
+                funAttributes[aType] = tOk;
+                globals.AddType(pos, varType.at(aType));
+                globals.AddOffset(pos, globals.localOffset);
+                globals.localOffset += varType.at(aWidth);
+            }
+            break;
+        }
+
+        case 2: {
+            const AttributesPosRef funAttributes = self;
+            const Attributes& varType = GetChild(self, 0);
+            const Attributes& nextAttributes = GetChild(self, 1);
+
+            if (nextAttributes.at(aType) == tError) {
+                funAttributes[aType] = tError;
+            }
+
+            if (nextAttributes.at(aValueType) != tVoid) {
+                funAttributes[aValueType] = varType.at(aType) * nextAttributes.at(aValueType);
+            } else {
+                funAttributes[aValueType] = varType.at(aType);
+            }
+            break;
+        }
+        }
+        break;
+
+    // NEXTATTRIBUTE -> , VARTYPE id NEXTATTRIBUTE
+    case 12:
+        switch (action) {
+        case 1: {
+            const AttributesPosRef nextAttributes = self;
+            const Attributes& varType = GetChild(self, 0);
+
+            const SymbolPos pos = id.GetSymbol();
+
+            if (globals.HasType(pos)) {
+                nextAttributes[aType] = tError;
+                LogSemanticError(
+                    globals,
+                    id,
+                    SemanticDiagnostic(
+                        SemanticError::IDENTIFIER_ALREADY_EXISTS,
+                        "El nombre de este atributo ya está en uso."
+                    )
+                );
+            } else {
+                nextAttributes[aType] = tOk;
+                globals.AddType(pos, varType.at(aType));
+                globals.AddOffset(pos, globals.localOffset);
+                globals.localOffset += varType.at(aWidth);
+            }
+            break;
+        }
+
+        case 2: {
+            const AttributesPosRef nextAttributes = self;
+            const Attributes& varType = GetChild(self, 0);
+            const Attributes& nextAttributes_1 = GetChild(self, 1);
+
+            if (nextAttributes.at(aType) == tError) {
+                nextAttributes[aType] = tError;
+            }
+
+            if (nextAttributes_1.at(aValueType) != tVoid) {
+                nextAttributes[aValueType] = varType.at(aType) * nextAttributes_1.at(aValueType);
+            } else {
+                nextAttributes[aValueType] = varType.at(aType);
+            }
+            break;
+        }
+        }
+        break;
+
+    // NEXTATTRIBUTE -> lambda
+    case 13: {
+        const AttributesPosRef nextAttributes = self;
+
+        nextAttributes[aType] = tOk;
+        nextAttributes[aValueType] = tVoid;
+        break;
+    }
+
+    // BODY -> STATEMENT BODY
+    case 14: {
+        const AttributesPosRef body = self;
+        const Attributes& statement = GetChild(self, 0);
+        const Attributes& body_1 = GetChild(self, 1);
+
+        if (statement.at(aType) == tOk) {
+            body[aType] = body_1.at(aType);
+        } else {
+            body[aType] = tError;
+        }
+
+        if (statement.at(aValueType) == body_1.at(aValueType) || statement.at(aValueType) == tVoid) {
+            body[aValueType] = body_1.at(aValueType);
+        } else if (body_1.at(aValueType) == tVoid) {
+            body[aValueType] = statement.at(aValueType);
+        } else {
+            body[aValueType] = tError;
+        }
+        break;
+    }
+
+    // BODY -> lambda
+    case 15: {
+        const AttributesPosRef body = self;
+
+        body[aType] = tOk;
+        body[aValueType] = tVoid;
+        break;
+    }
+
+    // STATEMENT -> if ( EXP1 ) ATOMSTATEMENT
+    case 16:
+        switch (action) {
+        case 1: {
+            const AttributesPosRef statement = self;
+            const Attributes& exp1 = GetChild(self, 0);
+
+            if (exp1.at(aType) == tError) {
+                statement[aType] = tError;
+            } else if (exp1.at(aType) != tLog) {
+                LogSemanticError(
+                    globals,
+                    exp1,
+                    SemanticDiagnostic(
+                        SemanticError::INVALID_IF_CONDITION_TYPE,
+                        "El argumento de «if» debe ser de tipo «boolean». El tipo "
+                        "evaluado es «{}».",
+                        exp1.at(aType)
+                    )
+                );
+                statement[aType] = tError;
+            } else {
+                statement[aType] = tOk;
+            }
+            break;
+        }
+
+        case 2: {
+            const AttributesPosRef statement = self;
+            const Attributes& atomStatement = GetChild(self, 1);
+
+            if (statement.at(aType) != tError) {
+                statement[aType] = atomStatement.at(aType);
+            }
+
+            statement[aValueType] = atomStatement.at(aValueType);
+            break;
+        }
+        }
+        break;
+
+    // STATEMENT -> for ( FORACT ; EXP1 ; FORACT ) { BODY }
+    case 17:
+        switch (action) {
+        case 1: {
+            const AttributesPosRef statement = self;
+            const Attributes& forAct_1 = GetChild(self, 0);
+
+            if (forAct_1.at(aType) == tError) {
+                statement[aType] = tError;
+            } else {
+                statement[aType] = tOk;
+            }
+            break;
+        }
+
+        case 2: {
+            const AttributesPosRef statement = self;
+            const Attributes& exp1 = GetChild(self, 1);
+
+            if (exp1.at(aType) == tError) {
+                statement[aType] = tError;
+            } else if (exp1.at(aType) != tLog) {
+                statement[aType] = tError;
+                LogSemanticError(
+                    globals,
+                    exp1,
+                    SemanticDiagnostic(
+                        SemanticError::INVALID_FOR_CONDITION_TYPE,
+                        "El segundo argumento de «for» debe ser de tipo «boolean». El tipo "
+                        "evaluado es «{}».",
+                        exp1.at(aType)
+                    )
+                );
+            }
+            break;
+        }
+
+        case 3: {
+            const AttributesPosRef statement = self;
+            const Attributes& forAct_2 = GetChild(self, 2);
+
+            if (forAct_2.at(aType) == tError) {
+                statement[aType] = tError;
+            }
+            break;
+        }
+
+        case 4: {
+            const AttributesPosRef statement = self;
+            const Attributes& body = GetChild(self, 3);
+
+            statement[aType] = body.at(aType);
+            statement[aValueType] = body.at(aValueType);
+            break;
+        }
+        }
+        break;
+
+    // STATEMENT -> var VARTYPE id ;
+    case 18:
+        switch (action) {
+        case 1:
+            globals.implicitDeclaration = false;
+            break;
+
+        case 2: {
+            const AttributesPosRef statement = self;
+            const Attributes& varType = GetChild(self, 0);
+
+            const SymbolPos pos = id.GetSymbol();
+
+            statement[aValueType] = tVoid;
+
+            if (globals.HasType(pos)) {
+                statement[aType] = tError;
+                LogSemanticError(
+                    globals,
+                    id,
+                    SemanticDiagnostic(
+                        SemanticError::IDENTIFIER_ALREADY_EXISTS,
+                        "El nombre de la variable a declarar ya está en uso."
+                    )
+                );
+            } else {
+                globals.AddType(pos, varType.at(aType));
+                auto& offset = globals.CurrentOffset();
+                globals.AddOffset(pos, offset);
+                offset += varType.at(aWidth);
+                statement[aType] = tOk;
+            }
+
+            globals.implicitDeclaration = true;
+            break;
+        }
+        }
+        break;
+
+    // STATEMENT -> ATOMSTATEMENT
+    case 19: {
+        const AttributesPosRef statement = self;
+        const Attributes& atomStatement = GetChild(self, 0);
+
+        statement[aType] = atomStatement.at(aType);
+        statement[aValueType] = atomStatement.at(aValueType);
+        break;
+    }
+
+    // ATOMSTATEMENT -> id IDACT ;
+    case 20: {
+        const AttributesPosRef atomStatement = self;
+        const Attributes& idAct = GetChild(self, 0);
+
+        const SymbolPos pos = id.GetSymbol();
+        const auto type = globals.GetType(pos);
+
+        atomStatement[aValueType] = tVoid;
+
+        if (idAct.at(aFunCall)) {
+            if (!IsFunction(type)) {
+                atomStatement[aType] = tError;
+                LogSemanticError(
+                    globals,
+                    atomStatement,
+                    SemanticDiagnostic(
+                        SemanticError::INCOHERENT_VARIABLE_AS_FUNCTION_TYPES,
+                        "No se puede llamar a una variable como si fuera una función."
+                    )
+                );
+            } else if (idAct.at(aType) == tError) {
+                atomStatement[aType] = tError;
+            } else if (idAct.at(aType) == GetFunctionArgsType(type)) {
+                atomStatement[aType] = tOk;
+            } else {
+                atomStatement[aType] = tError;
+                LogSemanticError(
+                    globals,
+                    idAct,
+                    SemanticDiagnostic(
+                        SemanticError::INCOHERENT_CALL_PARAM_TYPES,
+                        "Los tipos de los argumentos de llamada a la función no "
+                        "coinciden con los de la definición. Se esperaba «{}», "
+                        "pero se recibió «{}».",
+                        GetFunctionArgsType(type),
+                        idAct.at(aType)
+                    )
+                );
+            }
+        } else {
+            if (IsFunction(type)) {
+                atomStatement[aType] = tError;
+                LogSemanticError(
+                    globals,
+                    idAct,
+                    SemanticDiagnostic(
+                        SemanticError::INCOHERENT_FUNCTION_AS_VARIABLE_TYPES,
+                        "No se puede asignar valores a una función."
+                    )
+                );
+            } else if (idAct.at(aType) == tError) {
+                atomStatement[aType] = tError;
+            } else if (idAct.at(aType) == type) {
+                atomStatement[aType] = tOk;
+            } else {
+                atomStatement[aType] = tError;
+                LogSemanticError(
+                    globals,
+                    idAct,
+                    SemanticDiagnostic(
+                        SemanticError::INCOHERENT_TYPES,
+                        "Los tipos a ambos lados de la asignación no coinciden. "
+                        "La variable es de tipo «{}», pero la expresión es «{}».",
+                        type,
+                        idAct.at(aType)
+                    )
+                );
+            }
+        }
+        break;
+    }
+
+    // ATOMSTATEMENT -> output EXP1 ;
+    case 21: {
+        const AttributesPosRef atomStatement = self;
+        const Attributes& exp1 = GetChild(self, 0);
+
+        atomStatement[aValueType] = tVoid;
+
+        if (exp1.at(aType) == tError) {
+            atomStatement[aType] = tError;
+        } else if (exp1.at(aType) == tStr || exp1.at(aType) == tInt) {
+            atomStatement[aType] = tOk;
+        } else {
+            atomStatement[aType] = tError;
+            LogSemanticError(
+                globals,
+                exp1,
+                SemanticDiagnostic(
+                    SemanticError::INVALID_OUTPUT_TYPE,
+                    "Una expresión con tipo «{}» no se puede mostrar con «output». "
+                    "«output» permite mostrar «int» y «string».",
+                    exp1.at(aType)
+                )
+            );
+        }
+        break;
+    }
+
+    // ATOMSTATEMENT -> input id ;
+    case 22: {
+        const AttributesPosRef atomStatement = self;
+
+        const SymbolPos pos = id.GetSymbol();
+        const auto type = globals.GetType(pos);
+
+        atomStatement[aValueType] = tVoid;
+
+        if (type == tStr || type == tInt) {
+            atomStatement[aType] = tOk;
+        } else {
+            atomStatement[aType] = tError;
+            LogSemanticError(
+                globals,
+                id,
+                SemanticDiagnostic(
+                    SemanticError::INVALID_INPUT_TYPE,
+                    "Un objeto tipo «{}» no se puede usar con «input». "
+                    "«input» acepta variables de tipo «int» o «string».",
+                    type
+                )
+            );
+        }
+        break;
+    }
+
+    // ATOMSTATEMENT -> return RETURNEXP ;
+    case 23: {
+        const AttributesPosRef atomStatement = self;
+        const Attributes& returnExp = GetChild(self, 0);
+
+        if (returnExp.at(aType) != tError) {
+            atomStatement[aType] = tOk;
+        } else {
+            atomStatement[aType] = tError;
+        }
+
+        atomStatement[aValueType] = returnExp.at(aType);
+        break;
+    }
+
+    // IDACT -> ASS EXP1
+    case 24: {
+        const AttributesPosRef idAct = self;
+        const Attributes& ass = GetChild(self, 0);
+        const Attributes& exp1 = GetChild(self, 1);
+
+        const auto& type = exp1.at(aType);
+
+        idAct[aFunCall] = false;
+
+        if (ass.at(aSum)) {
+            if (type == tInt || type == tStr) {
+                idAct[aType] = type;
+            } else {
+                idAct[aType] = tError;
+                LogSemanticError(
+                    globals,
+                    exp1,
+                    SemanticDiagnostic(
+                        SemanticError::INVALID_TYPE,
+                        "Sólo se puede incrementar con expresiones de tipo "
+                        "«int» o concatenar con expresiones de tipo "
+                        "«string». El tipo actual es {}.",
+                        type,
+                        idAct.at(aType)
+                    )
+                );
+            }
+        } else {
+            idAct[aType] = type;
+        }
+        break;
+    }
+
+    // IDACT -> ( CALLPARAM )
+    case 25: {
+        const AttributesPosRef idAct = self;
+        const Attributes& callParams = GetChild(self, 0);
+
+        idAct[aFunCall] = true;
+        idAct[aType] = callParams.at(aType);
+        break;
+    }
+
+    // FORACT -> id ASS EXP1
+    case 26: {
+        const AttributesPosRef forAct = self;
+        const Attributes& exp1 = GetChild(self, 1);
+
+        const SymbolPos pos = id.GetSymbol();
+        const auto type = globals.GetType(pos);
+
+        if (type != tInt) {
+            forAct[aType] = tError;
+            LogSemanticError(
+                globals,
+                id,
+                SemanticDiagnostic(
+                    SemanticError::INVALID_FOR_ACTION_TYPE,
+                    "El tipo de una variable en «for» debe de ser «int». El tipo actual es «{}».",
+                    type
+                )
+            );
+        } else if (exp1.at(aType) == tError) {
+            forAct[aType] = tError;
+        } else if (exp1.at(aType) != tInt) {
+            forAct[aType] = tError;
+            LogSemanticError(
+                globals,
+                exp1,
+                SemanticDiagnostic(
+                    SemanticError::INCOHERENT_TYPES,
+                    "Se esperaba una expresión con tipo «int». El tipo de la expresión es «{}».",
+                    exp1.at(aType)
+                )
+            );
+        } else {
+            forAct[aType] = tOk;
+        }
+        break;
+    }
+
+    // FORACT -> lambda
+    case 27: {
+        const AttributesPosRef forAct = self;
+
+        forAct[aType] = tOk;
+        break;
+    }
+
+    // ASS -> =
+    case 28: {
+        const AttributesPosRef ass = self;
+
+        ass[aSum] = false;
+        break;
+    }
+
+    // ASS -> +=
+    case 29: {
+        const AttributesPosRef ass = self;
+
+        ass[aSum] = true;
+        break;
+    }
+
+    // CALLPARAM -> EXP1 NEXTPARAM
+    case 30: {
+        const AttributesPosRef callParams = self;
+        const Attributes& exp1 = GetChild(self, 0);
+        const Attributes& nextParams = GetChild(self, 1);
+
+        if (exp1.at(aType) == tError || nextParams.at(aType) == tError) {
+            callParams[aType] = tError;
+        } else if (nextParams.at(aType) != tVoid) {
+            callParams[aType] = exp1.at(aType) * nextParams.at(aType);
+        } else {
+            callParams[aType] = exp1.at(aType);
+        }
+        break;
+    }
+
+    // CALLPARAM -> lambda
+    case 31: {
+        const AttributesPosRef callParams = self;
+
+        callParams[aType] = tVoid;
+        break;
+    }
+
+    // NEXTPARAM -> , EXP1 NEXTPARAM
+    case 32: {
+        const AttributesPosRef nextParams = self;
+        const Attributes& exp1 = GetChild(self, 0);
+        const Attributes& nextParams_1 = GetChild(self, 1);
+
+        if (exp1.at(aType) == tError || nextParams_1.at(aType) == tError) {
+            nextParams[aType] = tError;
+        } else if (nextParams_1.at(aType) != tVoid) {
+            nextParams[aType] = exp1.at(aType) * nextParams_1.at(aType);
+        } else {
+            nextParams[aType] = exp1.at(aType);
+        }
+        break;
+    }
+
+    // NEXTPARAM -> lambda
+    case 33: {
+        const AttributesPosRef nextParams = self;
+
+        nextParams[aType] = tVoid;
+        break;
+    }
+
+    // RETURNEXP -> EXP1
+    case 34: {
+        const AttributesPosRef returnExp = self;
+        const Attributes& exp1 = GetChild(self, 0);
+
+        returnExp[aType] = exp1.at(aType);
+        break;
+    }
+
+    // RETURNEXP -> lambda
+    case 35: {
+        const AttributesPosRef returnExp = self;
+
+        returnExp[aType] = tVoid;
+        break;
+    }
+
+    // EXP1 -> EXP2 EXPOR
+    case 36: {
+        const AttributesPosRef exp1 = self;
+        const Attributes& exp2 = GetChild(self, 0);
+        const Attributes& expOr = GetChild(self, 1);
+
+        if (expOr.at(aType) == tVoid) {
+            exp1[aType] = exp2.at(aType);
+        } else if (exp2.at(aType) == tError) {
+            exp1[aType] = tError;
+        } else if (exp2.at(aType) != tLog) {
+            exp1[aType] = tError;
+            LogSemanticError(
+                globals,
+                exp2,
+                SemanticDiagnostic(
+                    SemanticError::INVALID_TYPE,
+                    "Para poder aplicar un operador lógico, la expresión debe ser de tipo «boolean». "
+                    "El tipo de la expresión es «{}».",
+                    exp2.at(aType)
+                )
+            );
+        } else if (expOr.at(aType) == tError) {
+            exp1[aType] = tError;
+        } else {
+            exp1[aType] = tLog;
+        }
+        break;
+    }
+
+    // EXPOR -> || EXP2 EXPOR
+    case 37: {
+        const AttributesPosRef expOr = self;
+        const Attributes& exp2 = GetChild(self, 0);
+        const Attributes& expOr_1 = GetChild(self, 1);
+
+        if (exp2.at(aType) == tError) {
+            expOr[aType] = tError;
+        } else if (exp2.at(aType) != tLog) {
+            expOr[aType] = tError;
+            LogSemanticError(
+                globals,
+                exp2,
+                SemanticDiagnostic(
+                    SemanticError::INVALID_TYPE,
+                    "Para poder aplicar un operador lógico, la expresión debe ser de tipo «boolean». "
+                    "El tipo de la expresión es «{}».",
+                    exp2.at(aType)
+                )
+            );
+        } else if (expOr_1.at(aType) == tError) {
+            expOr[aType] = tError;
+        } else {
+            expOr[aType] = tLog;
+        }
+        break;
+    }
+
+    // EXPOR -> lambda
+    case 38: {
+        const AttributesPosRef expOr = self;
+
+        expOr[aType] = tVoid;
+        break;
+    }
+
+    // EXP2 -> EXP3 EXPAND
+    case 39: {
+        const AttributesPosRef exp2 = self;
+        const Attributes& exp3 = GetChild(self, 0);
+        const Attributes& expAnd = GetChild(self, 1);
+
+        if (expAnd.at(aType) == tVoid) {
+            exp2[aType] = exp3.at(aType);
+        } else if (exp3.at(aType) == tError) {
+            exp2[aType] = tError;
+        } else if (exp3.at(aType) != tLog) {
+            exp2[aType] = tError;
+            LogSemanticError(
+                globals,
+                exp3,
+                SemanticDiagnostic(
+                    SemanticError::INVALID_TYPE,
+                    "Para poder aplicar un operador lógico, la expresión debe ser de tipo «boolean». "
+                    "El tipo de la expresión es «{}».",
+                    exp3.at(aType)
+                )
+            );
+        } else if (expAnd.at(aType) == tError) {
+            exp2[aType] = tError;
+        } else {
+            exp2[aType] = tLog;
+        }
+        break;
+    }
+
+    // EXPAND -> && EXP3 EXPAND
+    case 40: {
+        const AttributesPosRef expAnd = self;
+        const Attributes& exp3 = GetChild(self, 0);
+        const Attributes& expAnd_1 = GetChild(self, 1);
+
+        if (exp3.at(aType) == tError) {
+            expAnd[aType] = tError;
+        } else if (exp3.at(aType) != tLog) {
+            expAnd[aType] = tError;
+            LogSemanticError(
+                globals,
+                exp3,
+                SemanticDiagnostic(
+                    SemanticError::INVALID_TYPE,
+                    "Para poder aplicar un operador lógico, la expresión debe ser de tipo «boolean». "
+                    "El tipo de la expresión es «{}».",
+                    exp3.at(aType)
+                )
+            );
+        } else if (expAnd_1.at(aType) == tError) {
+            expAnd[aType] = tError;
+        } else {
+            expAnd[aType] = tLog;
+        }
+        break;
+    }
+
+    // EXPAND -> lambda
+    case 41: {
+        const AttributesPosRef expAnd = self;
+
+        expAnd[aType] = tVoid;
+        break;
+    }
+
+    // EXP3 -> EXP4 COMP
+    case 42: {
+        const AttributesPosRef exp3 = self;
+        const Attributes& exp4 = GetChild(self, 0);
+        const Attributes& comp = GetChild(self, 1);
+
+        if (comp.at(aType) == tVoid) {
+            exp3[aType] = exp4.at(aType);
+        } else if (exp4.at(aType) == tError) {
+            exp3[aType] = tError;
+        } else if (exp4.at(aType) != tInt) {
+            exp3[aType] = tError;
+            LogSemanticError(
+                globals,
+                exp4,
+                SemanticDiagnostic(
+                    SemanticError::INVALID_TYPE,
+                    "Sólo se pueden comparar valores de tipo «int». El tipo actual es «{}».",
+                    exp4.at(aType)
+                )
+            );
+        } else if (comp.at(aType) == tError) {
+            exp3[aType] = tError;
+        } else {
+            exp3[aType] = tLog;
+        }
+        break;
+    }
+
+    // COMP -> COMPOP EXP4 COMP
+    case 43: {
+        const AttributesPosRef comp = self;
+        const Attributes& exp4 = GetChild(self, 1);
+        const Attributes& comp_1 = GetChild(self, 2);
+
+        if (exp4.at(aType) == tError) {
+            comp[aType] = tError;
+        } else if (exp4.at(aType) != tInt) {
+            comp[aType] = tError;
+            LogSemanticError(
+                globals,
+                exp4,
+                SemanticDiagnostic(
+                    SemanticError::INVALID_TYPE,
+                    "Sólo se pueden comparar valores de tipo «int». El tipo actual es «{}».",
+                    exp4.at(aType)
+                )
+            );
+        } else if (comp_1.at(aType) == tError) {
+            comp[aType] = tError;
+        } else {
+            comp[aType] = tLog;
+        }
+        break;
+    }
+
+    // COMP -> lambda
+    case 44: {
+        const AttributesPosRef comp = self;
+
+        comp[aType] = tVoid;
+        break;
+    }
+
+    // EXP4 -> EXPATOM ARITH
+    case 47: {
+        const AttributesPosRef exp4 = self;
+        const Attributes& expAtom = GetChild(self, 0);
+        const Attributes& arith = GetChild(self, 1);
+
+        if (arith.at(aType) == tVoid) {
+            exp4[aType] = expAtom.at(aType);
+        } else if (expAtom.at(aType) != tInt && expAtom.at(aType) != tStr) {
+            exp4[aType] = tError;
+            LogSemanticError(
+                globals,
+                expAtom,
+                SemanticDiagnostic(
+                    SemanticError::INVALID_TYPE,
+                    "Una operación aritmética requiere que el tipo sea «int» o «string»."
+                    " El tipo actual es «{}».",
+                    expAtom.at(aType)
+                )
+            );
+        } else if (arith.at(aType) == tError) {
+            exp4[aType] = tError;
+        } else if (expAtom.at(aType) != arith.at(aType)) {
+            exp4[aType] = tError;
+            LogSemanticError(
+                globals,
+                exp4,
+                SemanticDiagnostic(
+                    SemanticError::INCOHERENT_TYPES,
+                    "Los tipos no concuerdan. Los tipos de las expresiones son «{}» y «{}».",
+                    expAtom.at(aType),
+                    arith.at(aType)
+                )
+            );
+        } else {
+            exp4[aType] = arith.at(aType);
+        }
+        break;
+    }
+
+    // ARITH -> ARITHOP EXPATOM ARITH
+    case 48: {
+        const AttributesPosRef arith = self;
+        const Attributes& arithOp = GetChild(self, 0);
+        const Attributes& expAtom = GetChild(self, 1);
+        const Attributes& arith_1 = GetChild(self, 2);
+
+        if (!arithOp.at(aSum) && expAtom.at(aType) != tInt) {
+            arith[aType] = tError;
+            LogSemanticError(
+                globals,
+                expAtom,
+                SemanticDiagnostic(
+                    SemanticError::INVALID_TYPE,
+                    "La resta sólo se puede realizar sobre expresiones de "
+                    "tipo «int», pero el tipo de la expresión es «{}».",
+                    expAtom.at(aType)
+                )
+            );
+        } else if (arithOp.at(aSum) && expAtom.at(aType) != tInt && expAtom.at(aType) != tStr) {
+            arith[aType] = tError;
+            LogSemanticError(
+                globals,
+                expAtom,
+                SemanticDiagnostic(
+                    SemanticError::INVALID_TYPE,
+                    "El operador «+» sólo se puede aplicar a expresiones de tipo "
+                    "«int» o «string», pero el tipo de la expresión es «{}».",
+                    expAtom.at(aType)
+                )
+            );
+        } else if (arith_1.at(aType) == tError) {
+            arith[aType] = tError;
+        } else if (arith_1.at(aType) != tVoid && expAtom.at(aType) != arith_1.at(aType)) {
+            arith[aType] = tError;
+            LogSemanticError(
+                globals,
+                expAtom,
+                arith_1,
+                SemanticDiagnostic(
+                    SemanticError::INCOHERENT_TYPES,
+                    "Los tipos no concuerdan. Los tipos de las expresiones son «{}» y «{}».",
+                    expAtom.at(aType),
+                    arith_1.at(aType)
+                )
+            );
+        } else {
+            arith[aType] = expAtom.at(aType);
+        }
+        break;
+    }
+
+    // ARITH -> lambda
+    case 49: {
+        const AttributesPosRef arith = self;
+
+        arith[aType] = tVoid;
+        break;
+    }
+
+    // ARITHOP -> +
+    case 50: {
+        const AttributesPosRef arithOp = self;
+
+        arithOp[aSum] = true;
+        break;
+    }
+
+    // ARITHOP -> -
+    case 51: {
+        const AttributesPosRef arithOp = self;
+
+        arithOp[aSum] = false;
+        break;
+    }
+
+    // EXPATOM -> id IDVAL
+    case 52: {
+        const AttributesPosRef expAtom = self;
+        const Attributes& idVal = GetChild(self, 0);
+
+        const SymbolPos pos = id.GetSymbol();
+        const auto type = globals.GetType(pos);
+
+        if (idVal.at(aFunCall)) {
+            if (!IsFunction(type)) {
+                expAtom[aType] = tError;
+                LogSemanticError(
+                    globals,
+                    expAtom,
+                    SemanticDiagnostic(
+                        SemanticError::INCOHERENT_VARIABLE_AS_FUNCTION_TYPES,
+                        "No se puede llamar a una variable como si fuera una función."
+                    )
+                );
+            } else if (idVal.at(aType) == tError) {
+                expAtom[aType] = tError;
+            } else if (idVal.at(aType) == GetFunctionArgsType(type)) {
+                expAtom[aType] = GetFunctionReturnType(type);
+            } else {
+                expAtom[aType] = tError;
+                LogSemanticError(
+                    globals,
+                    idVal,
+                    SemanticDiagnostic(
+                        SemanticError::INCOHERENT_CALL_PARAM_TYPES,
+                        "Los tipos de los argumentos de llamada a la función no "
+                        "coinciden con los de la definición. Se esperaba «{}», "
+                        "pero se recibió «{}».",
+                        GetFunctionArgsType(type),
+                        idVal.at(aType)
+                    )
+                );
+            }
+        } else {
+            if (IsFunction(type)) {
+                expAtom[aType] = tError;
+                LogSemanticError(
+                    globals,
+                    idVal,
+                    SemanticDiagnostic(
+                        SemanticError::INCOHERENT_FUNCTION_AS_VARIABLE_TYPES,
+                        "No se puede asignar valores a una función."
+                    )
+                );
+            } else {
+                expAtom[aType] = type;
+            }
+        }
+        break;
+    }
+
+    // EXPATOM -> ( EXP1 )
+    case 53: {
+        const AttributesPosRef expAtom = self;
+        const Attributes& exp1 = GetChild(self, 0);
+
+        expAtom[aType] = exp1.at(aType);
+        break;
+    }
+
+    // EXPATOM -> cint
+    case 54: {
+        const AttributesPosRef expAtom = self;
+
+        expAtom[aType] = tInt;
+        break;
+    }
+
+    // EXPATOM -> cstr
+    case 55: {
+        const AttributesPosRef expAtom = self;
+
+        expAtom[aType] = tStr;
+        break;
+    }
+
+    // EXPATOM -> true
+    case 56: {
+        const AttributesPosRef expAtom = self;
+
+        expAtom[aType] = tLog;
+        break;
+    }
+
+    // EXPATOM -> false
+    case 57: {
+        const AttributesPosRef expAtom = self;
+
+        expAtom[aType] = tLog;
+        break;
+    }
+
+    // IDVAL -> ( CALLPARAM )
+    case 58: {
+        const AttributesPosRef idVal = self;
+        const Attributes& callParams = GetChild(self, 0);
+
+        idVal[aFunCall] = true;
+        idVal[aType] = callParams.at(aType);
+        break;
+    }
+
+    // IDVAL -> lambda
+    case 59: {
+        const AttributesPosRef idVal = self;
+
+        idVal[aFunCall] = false;
+        idVal[aType] = tVoid;
+        break;
+    }
+
+    default:
+        assert(false);
+        std::unreachable();
+    }
+}
+
+#pragma clang diagnostic pop
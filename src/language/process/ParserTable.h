@@ -0,0 +1,453 @@
+#pragma once
+
+#include "language/core/Token.h"
+#include "language/errors/SyntaxError.h"
+#include "language/process/ParserGrammar.h"
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+
+/*
+ * Tablas del analizador sintáctico descendente por tabla (véase
+ * Parser::ParseWithTable). La gramática y su tabla LL(1) se generan a partir
+ * de Gramática (véase ParserGrammar.h); aquí están los errores de cada no
+ * terminal y los pasos de cada producción. Cada producción es una lista de
+ * pasos que reproduce el orden del analizador recursivo: los terminales se
+ * comprueban y se consumen por separado para que las acciones semánticas
+ * puedan ir entre medias, igual que en Parser.cpp.
+ */
+
+/** Los tipos de paso de una producción. **/
+enum class StepKind : uint8_t {
+    /** Elige la producción del no terminal según el token actual y la analiza. **/
+    RULE,
+    /** Comprueba el tipo del token actual, sin consumirlo. Guarda los identificadores. **/
+    MATCH,
+    /** Consume el token actual. **/
+    NEXT,
+    /** Ejecuta una acción semántica de la producción, numeradas desde 1. **/
+    ACTION,
+    /** Termina la producción. **/
+    END
+};
+
+struct ParserStep {
+    StepKind kind = StepKind::END;
+    uint8_t value = 0;
+    SyntaxError error = SyntaxError::TOP_LEVEL_INVALID;
+
+    [[nodiscard]] constexpr NonTerminal GetRule() const {
+        return static_cast<NonTerminal>(value);
+    }
+
+    [[nodiscard]] constexpr TokenType GetTokenType() const {
+        return static_cast<TokenType>(value);
+    }
+};
+
+namespace ParserTable {
+    static_assert(TOKEN_TYPE_COUNT <= 32);
+
+    constexpr TokenSet ALL_TOKENS = (TokenSet { 1 } << TOKEN_TYPE_COUNT) - 1;
+
+    constexpr TokenSet Tokens(const std::initializer_list<TokenType> types) {
+        TokenSet set = 0;
+        for (const TokenType type : types)
+            set |= TokenSet { 1 } << std::to_underlying(type);
+        return set;
+    }
+
+    constexpr bool Contains(const TokenSet set, const TokenType type) {
+        return (set >> std::to_underlying(type) & 1) != 0;
+    }
+
+    /** El error sintáctico de un no terminal cuando ninguna producción admite el token actual. **/
+    struct RuleError {
+        NonTerminal rule;
+        TokenSet tokens;
+        SyntaxError error;
+    };
+
+    /** Los errores de cada no terminal, por orden de preferencia. **/
+    constexpr auto RULE_ERRORS = [] {
+        using enum NonTerminal;
+        using E = SyntaxError;
+
+        return std::to_array<RuleError>({
+            { P, ALL_TOKENS, E::TOP_LEVEL_INVALID },
+            { FUNCTION, ALL_TOKENS, E::FUNCTION_INVALID },
+            { FUNTYPE, ALL_TOKENS, E::FUNTYPE_INVALID },
+            { VARTYPE, Tokens({ TokenType::VOID }), E::VARTYPE_VOID },
+            { VARTYPE, ALL_TOKENS, E::VARTYPE_INVALID },
+            { FUNATTRIBUTES, Tokens({ TokenType::PARENTHESIS_CLOSE }), E::FUNATTRIBUTES_EMPTY },
+            { FUNATTRIBUTES, ALL_TOKENS, E::FUNATTRIBUTES_INVALID },
+            { STATEMENT, ALL_TOKENS, E::STATEMENT_INVALID },
+            { ATOMSTATEMENT, ALL_TOKENS, E::STATEMENT_INVALID },
+            { IDACT, ALL_TOKENS, E::IDACT_INVALID },
+            { ASS, ALL_TOKENS, E::ASS_INVALID },
+            { EXP1, ALL_TOKENS, E::EXP_INVALID },
+            { EXP2, ALL_TOKENS, E::EXP_INVALID },
+            { EXP3, ALL_TOKENS, E::EXP_INVALID },
+            { COMPOP, ALL_TOKENS, E::COMP_INVALID },
+            { EXP4, ALL_TOKENS, E::EXP_INVALID },
+            { ARITHOP, ALL_TOKENS, E::ARITH_INVALID },
+            { EXPATOM, ALL_TOKENS, E::EXP_INVALID }
+        });
+    }();
+
+    constexpr uint8_t Predict(const NonTerminal rule, const TokenType type) {
+        return PREDICTION_TABLE[std::to_underlying(rule)][std::to_underlying(type)];
+    }
+
+    constexpr SyntaxError GetRuleError(const NonTerminal rule, const TokenType type) {
+        for (const RuleError& ruleError : RULE_ERRORS) {
+            if (ruleError.rule == rule && Contains(ruleError.tokens, type))
+                return ruleError.error;
+        }
+
+        std::unreachable();
+    }
+
+    static_assert([] {
+        // Todos los no terminales que pueden fallar tienen un error para cualquier token.
+        for (size_t rule = 0; rule < RULE_COUNT; rule++) {
+            for (size_t type = 0; type < TOKEN_TYPE_COUNT; type++) {
+                if (PREDICTION_TABLE[rule][type] != 0)
+                    continue;
+
+                bool found = false;
+                for (const RuleError& ruleError : RULE_ERRORS) {
+                    if (std::to_underlying(ruleError.rule) == rule
+                        && Contains(ruleError.tokens, static_cast<TokenType>(type)))
+                        found = true;
+                }
+
+                if (!found)
+                    return false;
+            }
+        }
+
+        return true;
+    }());
+
+    constexpr ParserStep Rule(const NonTerminal rule) {
+        return { .kind = StepKind::RULE, .value = std::to_underlying(rule) };
+    }
+
+    constexpr ParserStep Match(const TokenType type, const SyntaxError error) {
+        return { .kind = StepKind::MATCH, .value = std::to_underlying(type), .error = error };
+    }
+
+    constexpr ParserStep Next() {
+        return { .kind = StepKind::NEXT };
+    }
+
+    constexpr ParserStep Action(const uint8_t action) {
+        return { .kind = StepKind::ACTION, .value = action };
+    }
+
+    constexpr ParserStep End() {
+        return { .kind = StepKind::END };
+    }
+
+    /** Los pasos de todas las producciones, seguidas y en orden, cada una terminada en End. **/
+    constexpr auto STEPS = [] {
+        using enum NonTerminal;
+        using T = TokenType;
+        using E = SyntaxError;
+
+        return std::to_array<ParserStep>({
+            // 1. P -> FUNCTION P
+            Rule(NonTerminal::FUNCTION), Rule(P), Action(1), End(),
+            // 2. P -> STATEMENT P
+            Rule(STATEMENT), Rule(P), Action(1), End(),
+            // 3. P -> eof
+            Action(1), End(),
+
+            // 4. FUNCTION -> function FUNTYPE id ( FUNATTRIBUTES ) { BODY }
+            Action(1), Next(),
+            Rule(FUNTYPE),
+            Match(T::IDENTIFIER, E::FUNCTION_MISSING_IDENTIFIER), Action(2), Next(),
+            Match(T::PARENTHESIS_OPEN, E::FUNCTION_MISSING_PAREN_OPEN), Next(),
+            Rule(FUNATTRIBUTES), Action(3),
+            Match(T::PARENTHESIS_CLOSE, E::FUNCTION_MISSING_PAREN_CLOSE), Next(),
+            Match(T::CURLY_BRACKET_OPEN, E::FUNCTION_MISSING_BRACK_OPEN), Next(),
+            Rule(BODY),
+            Match(T::CURLY_BRACKET_CLOSE, E::FUNCTION_MISSING_BRACK_CLOSE), Action(4), Next(),
+            End(),
+
+            // 5. FUNTYPE -> void
+            Action(1), Next(), End(),
+            // 6. FUNTYPE -> VARTYPE
+            Rule(VARTYPE), Action(1), End(),
+
+            // 7. VARTYPE -> int
+            Action(1), Next(), End(),
+            // 8. VARTYPE -> boolean
+            Action(1), Next(), End(),
+            // 9. VARTYPE -> string
+            Action(1), Next(), End(),
+
+            // 10. FUNATTRIBUTES -> void
+            Action(1), Next(), End(),
+            // 11. FUNATTRIBUTES -> VARTYPE id NEXTATTRIBUTE
+            Rule(VARTYPE),
+            Match(T::IDENTIFIER, E::FUNATTRIBUTES_MISSING_IDENTIFIER), Action(1), Next(),
+            Rule(NEXTATTRIBUTE), Action(2),
+            End(),
+
+            // 12. NEXTATTRIBUTE -> , VARTYPE id NEXTATTRIBUTE
+            Next(),
+            Rule(VARTYPE),
+            Match(T::IDENTIFIER, E::FUNATTRIBUTES_MISSING_IDENTIFIER), Action(1), Next(),
+            Rule(NEXTATTRIBUTE), Action(2),
+            End(),
+            // 13. NEXTATTRIBUTE -> lambda
+            Action(1), End(),
+
+            // 14. BODY -> STATEMENT BODY
+            Rule(STATEMENT), Rule(BODY), Action(1), End(),
+            // 15. BODY -> lambda
+            Action(1), End(),
+
+            // 16. STATEMENT -> if ( EXP1 ) ATOMSTATEMENT
+            Next(),
+            Match(T::PARENTHESIS_OPEN, E::STATEMENT_IF_MISSING_PAREN_OPEN), Next(),
+            Rule(EXP1), Action(1),
+            Match(T::PARENTHESIS_CLOSE, E::STATEMENT_IF_MISSING_PAREN_CLOSE), Next(),
+            Rule(ATOMSTATEMENT), Action(2),
+            End(),
+            // 17. STATEMENT -> for ( FORACT ; EXP1 ; FORACT ) { BODY }
+            Next(),
+            Match(T::PARENTHESIS_OPEN, E::STATEMENT_FOR_MISSING_PAREN_OPEN), Next(),
+            Rule(FORACT), Action(1),
+            Match(T::SEMICOLON, E::STATEMENT_FOR_MISSING_SEMICOLON), Next(),
+            Rule(EXP1), Action(2),
+            Match(T::SEMICOLON, E::STATEMENT_FOR_MISSING_SEMICOLON), Next(),
+            Rule(FORACT), Action(3),
+            Match(T::PARENTHESIS_CLOSE, E::STATEMENT_FOR_MISSING_PAREN_CLOSE), Next(),
+            Match(T::CURLY_BRACKET_OPEN, E::STATEMENT_FOR_MISSING_BRACK_OPEN), Next(),
+            Rule(BODY),
+            Match(T::CURLY_BRACKET_CLOSE, E::STATEMENT_FOR_MISSING_BRACK_CLOSE), Action(4), Next(),
+            End(),
+            // 18. STATEMENT -> var VARTYPE id ;
+            Next(), Action(1),
+            Rule(VARTYPE),
+            Match(T::IDENTIFIER, E::STATEMENT_VAR_MISSING_IDENTIFIER), Action(2), Next(),
+            Match(T::SEMICOLON, E::STATEMENT_MISSING_END_SEMICOLON), Next(),
+            End(),
+            // 19. STATEMENT -> ATOMSTATEMENT
+            Rule(ATOMSTATEMENT), Action(1), End(),
+
+            // 20. ATOMSTATEMENT -> id IDACT ;
+            Match(T::IDENTIFIER, E::STATEMENT_INVALID), Next(),
+            Rule(IDACT), Action(1),
+            Match(T::SEMICOLON, E::STATEMENT_MISSING_END_SEMICOLON), Next(),
+            End(),
+            // 21. ATOMSTATEMENT -> output EXP1 ;
+            Next(),
+            Rule(EXP1), Action(1),
+            Match(T::SEMICOLON, E::STATEMENT_MISSING_END_SEMICOLON), Next(),
+            End(),
+            // 22. ATOMSTATEMENT -> input id ;
+            Next(),
+            Match(T::IDENTIFIER, E::STATEMENT_INPUT_MISSING_IDENTIFIER), Action(1), Next(),
+            Match(T::SEMICOLON, E::STATEMENT_MISSING_END_SEMICOLON), Next(),
+            End(),
+            // 23. ATOMSTATEMENT -> return RETURNEXP ;
+            Next(),
+            Rule(RETURNEXP), Action(1),
+            Match(T::SEMICOLON, E::STATEMENT_MISSING_END_SEMICOLON), Next(),
+            End(),
+
+            // 24. IDACT -> ASS EXP1
+            Rule(ASS), Rule(EXP1), Action(1), End(),
+            // 25. IDACT -> ( CALLPARAM )
+            Next(),
+            Rule(CALLPARAM), Action(1),
+            Match(T::PARENTHESIS_CLOSE, E::IDACT_CALL_MISSING_PAREN_CLOSE), Next(),
+            End(),
+
+            // 26. FORACT -> id ASS EXP1
+            Match(T::IDENTIFIER, E::STATEMENT_INVALID), Next(),
+            Rule(ASS), Rule(EXP1), Action(1),
+            End(),
+            // 27. FORACT -> lambda
+            Action(1), End(),
+
+            // 28. ASS -> =
+            Next(), Action(1), End(),
+            // 29. ASS -> +=
+            Next(), Action(1), End(),
+
+            // 30. CALLPARAM -> EXP1 NEXTPARAM
+            Rule(EXP1), Rule(NEXTPARAM), Action(1), End(),
+            // 31. CALLPARAM -> lambda
+            Action(1), End(),
+
+            // 32. NEXTPARAM -> , EXP1 NEXTPARAM
+            Next(), Rule(EXP1), Rule(NEXTPARAM), Action(1), End(),
+            // 33. NEXTPARAM -> lambda
+            Action(1), End(),
+
+            // 34. RETURNEXP -> EXP1
+            Rule(EXP1), Action(1), End(),
+            // 35. RETURNEXP -> lambda
+            Action(1), End(),
+
+            // 36. EXP1 -> EXP2 EXPOR
+            Rule(EXP2), Rule(EXPOR), Action(1), End(),
+            // 37. EXPOR -> || EXP2 EXPOR
+            Next(), Rule(EXP2), Rule(EXPOR), Action(1), End(),
+            // 38. EXPOR -> lambda
+            Action(1), End(),
+
+            // 39. EXP2 -> EXP3 EXPAND
+            Rule(EXP3), Rule(EXPAND), Action(1), End(),
+            // 40. EXPAND -> && EXP3 EXPAND
+            Next(), Rule(EXP3), Rule(EXPAND), Action(1), End(),
+            // 41. EXPAND -> lambda
+            Action(1), End(),
+
+            // 42. EXP3 -> EXP4 COMP
+            Rule(EXP4), Rule(COMP), Action(1), End(),
+            // 43. COMP -> COMPOP EXP4 COMP
+            Rule(COMPOP), Rule(EXP4), Rule(COMP), Action(1), End(),
+            // 44. COMP -> lambda
+            Action(1), End(),
+
+            // 45. COMPOP -> >
+            Next(), End(),
+            // 46. COMPOP -> <
+            Next(), End(),
+
+            // 47. EXP4 -> EXPATOM ARITH
+            Rule(EXPATOM), Rule(ARITH), Action(1), End(),
+            // 48. ARITH -> ARITHOP EXPATOM ARITH
+            Rule(ARITHOP), Rule(EXPATOM), Rule(ARITH), Action(1), End(),
+            // 49. ARITH -> lambda
+            Action(1), End(),
+
+            // 50. ARITHOP -> +
+            Action(1), Next(), End(),
+            // 51. ARITHOP -> -
+            Action(1), Next(), End(),
+
+            // 52. EXPATOM -> id IDVAL
+            Match(T::IDENTIFIER, E::EXP_INVALID), Next(),
+            Rule(IDVAL), Action(1),
+            End(),
+            // 53. EXPATOM -> ( EXP1 )
+            Next(),
+            Rule(EXP1), Action(1),
+            Match(T::PARENTHESIS_CLOSE, E::EXP_MISSING_PAREN_CLOSE), Next(),
+            End(),
+            // 54. EXPATOM -> cint
+            Action(1), Next(), End(),
+            // 55. EXPATOM -> cstr
+            Action(1), Next(), End(),
+            // 56. EXPATOM -> true
+            Action(1), Next(), End(),
+            // 57. EXPATOM -> false
+            Action(1), Next(), End(),
+
+            // 58. IDVAL -> ( CALLPARAM )
+            Next(),
+            Rule(CALLPARAM), Action(1),
+            Match(T::PARENTHESIS_CLOSE, E::IDACT_CALL_MISSING_PAREN_CLOSE), Next(),
+            End(),
+            // 59. IDVAL -> lambda
+            Action(1), End()
+        });
+    }();
+
+    /** Dónde empiezan en STEPS los pasos de cada producción. **/
+    constexpr std::array<uint16_t, PRODUCTION_COUNT + 1> PRODUCTION_STARTS = [] {
+        std::array<uint16_t, PRODUCTION_COUNT + 1> starts {};
+
+        size_t production = 1;
+        starts[production] = 0;
+        for (size_t i = 0; i < STEPS.size(); i++) {
+            if (STEPS[i].kind == StepKind::END && production < PRODUCTION_COUNT) {
+                production += 1;
+                starts[production] = static_cast<uint16_t>(i + 1);
+            }
+        }
+
+        return starts;
+    }();
+
+    static_assert([] {
+        size_t ends = 0;
+        for (const ParserStep& step : STEPS) {
+            if (step.kind == StepKind::END)
+                ends += 1;
+        }
+        return ends == PRODUCTION_COUNT && STEPS.back().kind == StepKind::END;
+    }());
+
+    /**
+     * Comprueba que los pasos de una producción recorren su parte derecha en
+     * Gramática: un RULE por no terminal y un NEXT por terminal, con un MATCH
+     * del mismo tipo antes salvo en el primero, que ya lo asegura la tabla.
+     * El fin del fichero no se consume.
+     */
+    constexpr bool StepsMatchGrammar(const size_t production) {
+        const Production& grammar = PRODUCTIONS[production - 1];
+
+        size_t symbol = 0;
+        bool matched = false;
+
+        for (size_t i = PRODUCTION_STARTS[production]; STEPS[i].kind != StepKind::END; i++) {
+            const ParserStep& step = STEPS[i];
+
+            if (step.kind == StepKind::ACTION)
+                continue;
+
+            if (symbol >= grammar.length)
+                return false;
+
+            const GrammarSymbol& expected = grammar.symbols[symbol];
+
+            switch (step.kind) {
+            case StepKind::RULE:
+                if (expected.isTerminal || expected.value != step.value)
+                    return false;
+                symbol += 1;
+                break;
+
+            case StepKind::MATCH:
+                if (!expected.isTerminal || expected.value != step.value)
+                    return false;
+                matched = true;
+                break;
+
+            case StepKind::NEXT:
+                if (!expected.isTerminal || (!matched && symbol != 0))
+                    return false;
+                symbol += 1;
+                matched = false;
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        if (symbol + 1 == grammar.length && grammar.symbols[symbol].isTerminal
+            && grammar.symbols[symbol].value == std::to_underlying(TokenType::END))
+            symbol += 1;
+
+        return symbol == grammar.length;
+    }
+
+    static_assert([] {
+        for (size_t production = 1; production <= PRODUCTION_COUNT; production++) {
+            if (!StepsMatchGrammar(production))
+                return false;
+        }
+        return true;
+    }());
+}
@@ -0,0 +1,65 @@
+#include "Parser.h"
+
+using enum TokenType;
+
+void Parser::PushRule(const NonTerminal rule, GlobalState& globals) {
+    const uint8_t production = ParserTable::Predict(rule, m_currentToken.type);
+    if (production == 0)
+        ThrowSyntaxError(ParserTable::GetRuleError(rule, m_currentToken.type));
+
+    WriteParse(globals, production);
+
+    m_frames.push_back({
+        .step = ParserTable::PRODUCTION_STARTS[production],
+        .production = production,
+        .attributes = CreateRuleAttributes(),
+        .id = {}
+    });
+}
+
+Parser::AttributesPosRef Parser::ParseWithTable(GlobalState& globals) {
+    assert(m_frames.empty() && m_attributesStack.empty());
+
+    PushRule(NonTerminal::P, globals);
+
+    while (true) {
+        // Se vuelve a buscar en cada paso: apilar una regla invalida las referencias.
+        Frame& frame = m_frames.back();
+        const ParserStep step = ParserTable::STEPS[frame.step];
+        frame.step += 1;
+
+        switch (step.kind) {
+        case StepKind::RULE:
+            PushRule(step.GetRule(), globals);
+            break;
+
+        case StepKind::MATCH:
+            VerifyTokenType(step.GetTokenType(), step.error);
+            if (m_currentToken.type == IDENTIFIER)
+                frame.id = m_currentToken;
+            break;
+
+        case StepKind::NEXT:
+            GetNextToken(globals);
+            break;
+
+        case StepKind::ACTION:
+            if (globals.useSemantic)
+                RunAction(frame.production, step.value, frame.attributes, globals, frame.id);
+            break;
+
+        case StepKind::END: {
+            // Como en el analizador recursivo, los atributos se quedan en la
+            // pila para la producción que la contiene.
+            const AttributesPosRef attributes = CloseRuleAttributes(frame.attributes);
+            m_frames.pop_back();
+
+            if (m_frames.empty())
+                return attributes;
+            break;
+        }
+        }
+    }
+}
+
+#pragma clang diagnostic pop
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "language/core/Token.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Los tokens de una entrada completa, analizada de una vez antes de
+ * procesarlos. Cada campo de los tokens se guarda en su propio vector,
+ * de forma que recorrer los tipos (lo que más consulta el analizador
+ * sintáctico) no arrastra el resto de campos a la caché.
+ */
+class TokenBuffer {
+    std::vector<TokenType> m_types;
+    std::vector<size_t> m_offsets;
+    std::vector<uint32_t> m_lengths;
+    std::vector<uint32_t> m_payloads;
+
+public:
+    /** Añade un token al final. **/
+    void Append(const Token& token) {
+        m_types.push_back(token.type);
+        m_offsets.push_back(token.offset);
+        m_lengths.push_back(token.length);
+        m_payloads.push_back(token.payload);
+    }
+
+    [[nodiscard]] size_t GetCount() const {
+        return m_types.size();
+    }
+
+    [[nodiscard]] TokenType GetType(const size_t index) const {
+        assert(index < m_types.size());
+        return m_types[index];
+    }
+
+    /** Obtiene un token completo a partir de sus campos. **/
+    [[nodiscard]] Token Get(const size_t index) const {
+        assert(index < m_types.size());
+        return Token {
+            .offset = m_offsets[index],
+            .payload = m_payloads[index],
+            .length = m_lengths[index],
+            .type = m_types[index]
+        };
+    }
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "language/core/Token.h"
+
+#include <cstdint>
+
+/*
+ * Formato binario del flujo de tokens (tarea «-b»). Todos los campos se
+ * escriben en el orden de bytes de la máquina, y el fichero tiene esta forma:
+ *
+ *   TokenStreamHeader
+ *   TokenRecord[tokenCount]         Los tokens, en orden.
+ *   StringRecord[symbolCount]       Los nombres de la tabla de símbolos global.
+ *   StringRecord[stringCount]       Los valores de las constantes de cadena.
+ *   char[dataSize]                  Los bytes de los nombres y las cadenas,
+ *                                   rellenos con ceros hasta múltiplo de 8.
+ *   TokenStreamTrailer
+ *
+ * Los contadores van al final para poder escribir el flujo de una pasada,
+ * incluso sobre una tubería.
+ */
+
+constexpr uint32_t TOKEN_STREAM_MAGIC = 0x544C4450; // «PDLT»
+constexpr uint32_t TOKEN_STREAM_VERSION = 1;
+
+struct TokenStreamHeader {
+    uint32_t magic;
+    uint32_t version;
+};
+
+struct TokenStreamTrailer {
+    uint64_t tokenCount;
+    uint64_t dataSize;
+    uint32_t symbolCount;
+    uint32_t stringCount;
+    uint32_t magic;
+    uint32_t version;
+};
+
+/** Un token del flujo binario. **/
+struct TokenRecord {
+    /** La posición en bytes del token en la entrada. **/
+    uint32_t offset;
+    /** Los bytes que ocupa el token en la entrada. **/
+    uint32_t length;
+    /**
+     * El contenido del token: la posición en la tabla de símbolos de un
+     * identificador, el índice del valor de una constante de cadena o el
+     * valor de una constante entera. Cero en el resto de tokens.
+     */
+    uint32_t attribute;
+    TokenType type;
+    uint8_t reserved[3];
+
+    /** Obtiene el valor de una constante entera. **/
+    [[nodiscard]] int16_t GetInteger() const {
+        assert(type == TokenType::CINT);
+        return static_cast<int16_t>(attribute);
+    }
+};
+
+/** Un tramo de los bytes de nombres y cadenas. **/
+struct StringRecord {
+    uint32_t offset;
+    uint32_t length;
+};
+
+static_assert(sizeof(TokenStreamHeader) == 8);
+static_assert(sizeof(TokenStreamTrailer) == 32);
+static_assert(sizeof(TokenRecord) == 16);
+static_assert(sizeof(StringRecord) == 8);
@@ -0,0 +1,97 @@
+#include "TokenStreamReader.h"
+
+#include <cstring>
+
+namespace {
+    template<typename T>
+    std::span<const T> GetRecords(const std::string_view bytes, const size_t offset, const size_t count) {
+        return { reinterpret_cast<const T*>(bytes.data() + offset), count };
+    }
+}
+
+bool TokenStreamReader::Parse(const std::string_view bytes) {
+    if (bytes.size() < sizeof(TokenStreamHeader) + sizeof(TokenStreamTrailer) || bytes.size() % 8 != 0)
+        return false;
+
+    TokenStreamHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    TokenStreamTrailer trailer;
+    std::memcpy(&trailer, bytes.data() + bytes.size() - sizeof(trailer), sizeof(trailer));
+
+    if (header.magic != TOKEN_STREAM_MAGIC || header.version != TOKEN_STREAM_VERSION)
+        return false;
+    if (trailer.magic != TOKEN_STREAM_MAGIC || trailer.version != TOKEN_STREAM_VERSION)
+        return false;
+
+    // Se comprueba que las secciones ocupen exactamente el fichero, sin desbordar los cálculos.
+    const size_t available = bytes.size() - sizeof(TokenStreamHeader) - sizeof(TokenStreamTrailer);
+    if (trailer.tokenCount > available / sizeof(TokenRecord))
+        return false;
+
+    const size_t tokensSize = trailer.tokenCount * sizeof(TokenRecord);
+    const size_t tablesSize = (static_cast<size_t>(trailer.symbolCount) + trailer.stringCount) * sizeof(StringRecord);
+    if (tablesSize > available - tokensSize)
+        return false;
+
+    const size_t paddedDataSize = available - tokensSize - tablesSize;
+    if (trailer.dataSize > paddedDataSize || paddedDataSize - trailer.dataSize >= 8)
+        return false;
+
+    size_t offset = sizeof(TokenStreamHeader);
+    m_tokens = GetRecords<TokenRecord>(bytes, offset, trailer.tokenCount);
+    offset += tokensSize;
+    m_symbols = GetRecords<StringRecord>(bytes, offset, trailer.symbolCount);
+    offset += m_symbols.size_bytes();
+    m_strings = GetRecords<StringRecord>(bytes, offset, trailer.stringCount);
+    offset += m_strings.size_bytes();
+    m_data = bytes.substr(offset, trailer.dataSize);
+
+    // Las tablas son pequeñas: se comprueban ya para que las consultas no fallen.
+    const auto isValid = [this](const StringRecord& record) {
+        return record.offset <= m_data.size() && record.length <= m_data.size() - record.offset;
+    };
+
+    for (const StringRecord& record : m_symbols) {
+        if (!isValid(record))
+            return false;
+    }
+
+    for (const StringRecord& record : m_strings) {
+        if (!isValid(record))
+            return false;
+    }
+
+    // También los tokens, para que sus atributos no se salgan de las tablas.
+    for (const TokenRecord& token : m_tokens) {
+        if (token.type > TokenType::CSTR)
+            return false;
+        if (token.type == TokenType::IDENTIFIER && token.attribute >= m_symbols.size())
+            return false;
+        if (token.type == TokenType::CSTR && token.attribute >= m_strings.size())
+            return false;
+    }
+
+    return true;
+}
+
+std::optional<TokenStreamReader> TokenStreamReader::Open(const std::string& fileName) {
+    auto file = MappedFile::Open(fileName);
+    if (!file.has_value())
+        return std::nullopt;
+
+    TokenStreamReader reader;
+    reader.m_file = std::move(file);
+    if (!reader.Parse(reader.m_file->GetBytes()))
+        return std::nullopt;
+
+    return reader;
+}
+
+std::optional<TokenStreamReader> TokenStreamReader::FromBytes(const std::string_view bytes) {
+    TokenStreamReader reader;
+    if (!reader.Parse(bytes))
+        return std::nullopt;
+
+    return reader;
+}
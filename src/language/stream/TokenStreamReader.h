@@ -0,0 +1,74 @@
+#pragma once
+
+#include "language/stream/TokenStream.h"
+#include "language/core/MappedFile.h"
+
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+/**
+ * Lee un flujo binario de tokens (véase TokenStream.h) sin copiarlo: los
+ * tokens y las tablas se recorren directamente sobre el fichero proyectado.
+ */
+class TokenStreamReader {
+    std::optional<MappedFile> m_file;
+
+    std::span<const TokenRecord> m_tokens;
+    std::span<const StringRecord> m_symbols;
+    std::span<const StringRecord> m_strings;
+    std::string_view m_data;
+
+    TokenStreamReader() = default;
+
+    bool Parse(std::string_view bytes);
+
+public:
+    /**
+     * Abre un fichero con un flujo binario de tokens. Se comprueba todo el
+     * flujo, de forma que las consultas sobre sus tokens no puedan fallar.
+     * @param fileName La ruta del fichero.
+     * @return El lector, o vacío si no se puede abrir el fichero o no es un flujo válido.
+     */
+    static std::optional<TokenStreamReader> Open(const std::string& fileName);
+
+    /**
+     * Lee un flujo binario de tokens que ya está en memoria. Los bytes deben
+     * estar alineados a 8 y seguir siendo válidos mientras se use el lector.
+     * @param bytes El contenido del flujo.
+     * @return El lector, o vacío si no es un flujo válido.
+     */
+    static std::optional<TokenStreamReader> FromBytes(std::string_view bytes);
+
+    /** Obtiene los tokens del flujo, en orden. **/
+    [[nodiscard]] std::span<const TokenRecord> GetTokens() const { return m_tokens; }
+
+    /** Obtiene el número de símbolos de la tabla de símbolos global. **/
+    [[nodiscard]] size_t GetSymbolCount() const { return m_symbols.size(); }
+
+    /**
+     * Obtiene el nombre del símbolo al que se refiere un identificador.
+     * @param token Un token identificador.
+     */
+    [[nodiscard]] std::string_view GetSymbolName(const TokenRecord& token) const {
+        assert(token.type == TokenType::IDENTIFIER);
+        assert(token.attribute < m_symbols.size());
+        return GetData(m_symbols[token.attribute]);
+    }
+
+    /**
+     * Obtiene el valor de una constante de cadena.
+     * @param token Un token de constante de cadena.
+     */
+    [[nodiscard]] std::string_view GetString(const TokenRecord& token) const {
+        assert(token.type == TokenType::CSTR);
+        assert(token.attribute < m_strings.size());
+        return GetData(m_strings[token.attribute]);
+    }
+
+    /** Obtiene los bytes a los que se refiere un tramo de las tablas. **/
+    [[nodiscard]] std::string_view GetData(const StringRecord& record) const {
+        return m_data.substr(record.offset, record.length);
+    }
+};
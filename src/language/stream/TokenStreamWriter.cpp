@@ -0,0 +1,98 @@
+#include "TokenStreamWriter.h"
+
+#include <limits>
+
+namespace {
+    constexpr uint64_t MAX_OFFSET = std::numeric_limits<uint32_t>::max();
+}
+
+TokenStreamWriter::TokenStreamWriter(std::ostream& output, const LiteralArena& literals)
+    : m_output(output), m_literals(literals) {
+    m_buffer.reserve(BLOCK_SIZE + sizeof(TokenRecord));
+    Append(TokenStreamHeader { .magic = TOKEN_STREAM_MAGIC, .version = TOKEN_STREAM_VERSION });
+}
+
+StringRecord TokenStreamWriter::AddData(const std::string_view bytes) {
+    if (m_data.size() + bytes.size() > MAX_OFFSET)
+        throw TokenStreamTooLargeException();
+
+    const StringRecord record {
+        .offset = static_cast<uint32_t>(m_data.size()),
+        .length = static_cast<uint32_t>(bytes.size())
+    };
+
+    m_data += bytes;
+    return record;
+}
+
+void TokenStreamWriter::Flush() {
+    m_output.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+    m_buffer.clear();
+}
+
+void TokenStreamWriter::Write(const Token& token) {
+    if (token.offset + token.length > MAX_OFFSET)
+        throw TokenStreamTooLargeException();
+
+    TokenRecord record {
+        .offset = static_cast<uint32_t>(token.offset),
+        .length = token.length,
+        .attribute = 0,
+        .type = token.type,
+        .reserved = {}
+    };
+
+    switch (token.type) {
+    case TokenType::CSTR:
+        record.attribute = static_cast<uint32_t>(m_strings.size());
+        m_strings.push_back(AddData(m_literals.Get(token.GetLiteralIndex())));
+        break;
+
+    case TokenType::IDENTIFIER:
+        assert(!token.GetSymbol().isLocal);
+        record.attribute = static_cast<uint32_t>(token.GetSymbol().pos);
+        break;
+
+    case TokenType::CINT:
+        // Las constantes enteras ya se guardan como en el flujo binario.
+        record.attribute = token.payload;
+        break;
+
+    default:
+        break;
+    }
+
+    Append(record);
+    m_tokenCount += 1;
+
+    if (m_buffer.size() >= BLOCK_SIZE)
+        Flush();
+}
+
+void TokenStreamWriter::Finish(const SymbolTable& symbols) {
+    const size_t symbolCount = symbols.GetSymbolCount();
+    for (size_t i = 0; i < symbolCount; i++)
+        Append(AddData(symbols.GetSymbolName(i)));
+
+    for (const StringRecord& record : m_strings)
+        Append(record);
+
+    Flush();
+
+    // Los bytes de nombres y cadenas se rellenan para que los contadores queden alineados.
+    const uint64_t dataSize = m_data.size();
+    m_data.resize((m_data.size() + 7) / 8 * 8, '\0');
+    m_output.write(m_data.data(), static_cast<std::streamsize>(m_data.size()));
+
+    Append(TokenStreamTrailer {
+        .tokenCount = m_tokenCount,
+        .dataSize = dataSize,
+        .symbolCount = static_cast<uint32_t>(symbolCount),
+        .stringCount = static_cast<uint32_t>(m_strings.size()),
+        .magic = TOKEN_STREAM_MAGIC,
+        .version = TOKEN_STREAM_VERSION
+    });
+
+    Flush();
+    m_output.flush();
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "language/stream/TokenStream.h"
+#include "language/core/SymbolTable.h"
+#include "language/core/LiteralArena.h"
+
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/** La entrada no cabe en el formato binario, cuyas posiciones son de 32 bits. **/
+class TokenStreamTooLargeException final : public std::runtime_error {
+public:
+    TokenStreamTooLargeException()
+        : std::runtime_error("La entrada es demasiado grande para el formato binario (máximo 4 GiB).") {}
+};
+
+/**
+ * Escribe los tokens en el formato binario de TokenStream.h. Los tokens
+ * se vuelcan a la salida por bloques a medida que llegan; los nombres y
+ * las cadenas se acumulan hasta el final.
+ */
+class TokenStreamWriter {
+    static constexpr size_t BLOCK_SIZE = 256 * 1024;
+
+    std::ostream& m_output;
+    const LiteralArena& m_literals;
+    std::string m_buffer;
+
+    uint64_t m_tokenCount = 0;
+
+    std::vector<StringRecord> m_strings;
+    std::string m_data;
+
+    template<typename T>
+    void Append(const T& value) {
+        m_buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    StringRecord AddData(std::string_view bytes);
+
+    void Flush();
+
+public:
+    /**
+     * @param output La salida.
+     * @param literals Donde están los valores de las constantes de cadena.
+     */
+    TokenStreamWriter(std::ostream& output, const LiteralArena& literals);
+
+    TokenStreamWriter(const TokenStreamWriter&) = delete;
+    TokenStreamWriter& operator=(const TokenStreamWriter&) = delete;
+
+    /**
+     * Añade un token al flujo.
+     * @param token El token a escribir.
+     * @throws TokenStreamTooLargeException Si el token queda fuera de los 4 GiB del formato.
+     */
+    void Write(const Token& token);
+
+    /**
+     * Termina el flujo: escribe las tablas de nombres y cadenas y los contadores.
+     * @param symbols La tabla de símbolos a la que se refieren los identificadores.
+     * @throws TokenStreamTooLargeException Si los nombres y las cadenas no caben en 4 GiB.
+     */
+    void Finish(const SymbolTable& symbols);
+};
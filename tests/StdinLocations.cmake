@@ -0,0 +1,40 @@
+# Comprueba que los errores semánticos se sitúan igual al leer la entrada
+# estándar que al leer un fichero, aunque la regla con el error empiece
+# varios MiB antes del token en el que se detecta (véase Lexer::KeepLocatable).
+#
+# Uso: cmake -DPDL=<ejecutable> -DWORK_DIR=<directorio> -P StdinLocations.cmake
+
+string(REPEAT "c" 600 COMMENT)
+string(REPEAT "    /* ${COMMENT} */ s = 1;\n" 5000 BODY)
+
+set(INPUT ${WORK_DIR}/StdinLocations.txt)
+file(WRITE ${INPUT} "var int s;\n\nfunction int f(void) {\n${BODY}    return 'x';\n}\n")
+
+set(EXPECTED "(3:10) UE-0101")
+
+# El analizador recursivo y el de tabla.
+foreach (PARSER_OPTION IN ITEMS "" --table-parser)
+    set(PARSER_NAME "el analizador por tabla")
+    if (PARSER_OPTION STREQUAL "")
+        set(PARSER_NAME "el analizador recursivo")
+    endif ()
+
+    execute_process(
+            COMMAND ${PDL} -p -u ${PARSER_OPTION} -i ${INPUT} -o ${WORK_DIR}/StdinLocations.file.out
+            ERROR_VARIABLE FILE_ERRORS
+    )
+    execute_process(
+            COMMAND ${PDL} -p -u ${PARSER_OPTION} -o ${WORK_DIR}/StdinLocations.stdin.out
+            INPUT_FILE ${INPUT}
+            ERROR_VARIABLE STDIN_ERRORS
+    )
+
+    string(FIND "${FILE_ERRORS}" "${EXPECTED}" FILE_FOUND)
+    if (FILE_FOUND EQUAL -1)
+        message(FATAL_ERROR "Con ${PARSER_NAME}, el fichero no da «${EXPECTED}»:\n${FILE_ERRORS}")
+    endif ()
+
+    if (NOT STDIN_ERRORS STREQUAL FILE_ERRORS)
+        message(FATAL_ERROR "Con ${PARSER_NAME}, la entrada estándar da otros errores:\n${STDIN_ERRORS}")
+    endif ()
+endforeach ()
@@ -0,0 +1,541 @@
+// Genera language/process/ParserGrammar.h, en el directorio de compilación,
+// a partir de Gramática: las producciones, los conjuntos First y Follow y la
+// tabla LL(1) del analizador por tabla. Termina con error si la gramática no
+// es LL(1), de forma que el objetivo «ParserTables» de CMake, del que depende
+// PDL, no compila.
+
+#include "language/core/Token.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    constexpr size_t TOKEN_TYPE_COUNT = std::to_underlying(TokenType::CSTR) + 1;
+
+    using TokenSet = uint32_t;
+
+    static_assert(TOKEN_TYPE_COUNT <= 32);
+
+    /** Un terminal de Gramática y su tipo de token. **/
+    struct Terminal {
+        std::string_view text;
+        TokenType type;
+        std::string_view name;
+    };
+
+    constexpr Terminal TERMINALS[] = {
+        { "eof", TokenType::END, "END" },
+        { "boolean", TokenType::BOOL, "BOOL" },
+        { "for", TokenType::FOR, "FOR" },
+        { "function", TokenType::FUNCTION, "FUNCTION" },
+        { "if", TokenType::IF, "IF" },
+        { "input", TokenType::INPUT, "INPUT" },
+        { "output", TokenType::OUTPUT, "OUTPUT" },
+        { "return", TokenType::RETURN, "RETURN" },
+        { "int", TokenType::INT, "INT" },
+        { "string", TokenType::STRING, "STRING" },
+        { "var", TokenType::VAR, "VAR" },
+        { "void", TokenType::VOID, "VOID" },
+        { "id", TokenType::IDENTIFIER, "IDENTIFIER" },
+        { "=", TokenType::ASSIGN, "ASSIGN" },
+        { "+=", TokenType::CUMULATIVE_ASSIGN, "CUMULATIVE_ASSIGN" },
+        { "+", TokenType::SUM, "SUM" },
+        { "-", TokenType::SUB, "SUB" },
+        { "&&", TokenType::AND, "AND" },
+        { "||", TokenType::OR, "OR" },
+        { "<", TokenType::LESS, "LESS" },
+        { ">", TokenType::GREATER, "GREATER" },
+        { "true", TokenType::TRUE, "TRUE" },
+        { "false", TokenType::FALSE, "FALSE" },
+        { ",", TokenType::COMMA, "COMMA" },
+        { ";", TokenType::SEMICOLON, "SEMICOLON" },
+        { "(", TokenType::PARENTHESIS_OPEN, "PARENTHESIS_OPEN" },
+        { ")", TokenType::PARENTHESIS_CLOSE, "PARENTHESIS_CLOSE" },
+        { "{", TokenType::CURLY_BRACKET_OPEN, "CURLY_BRACKET_OPEN" },
+        { "}", TokenType::CURLY_BRACKET_CLOSE, "CURLY_BRACKET_CLOSE" },
+        { "cint", TokenType::CINT, "CINT" },
+        { "cstr", TokenType::CSTR, "CSTR" }
+    };
+
+    static_assert(std::size(TERMINALS) == TOKEN_TYPE_COUNT);
+
+    const Terminal* FindTerminal(const std::string_view text) {
+        for (const Terminal& terminal : TERMINALS) {
+            if (terminal.text == text)
+                return &terminal;
+        }
+
+        return nullptr;
+    }
+
+    const Terminal& GetTerminal(const size_t type) {
+        for (const Terminal& terminal : TERMINALS) {
+            if (std::to_underlying(terminal.type) == type)
+                return terminal;
+        }
+
+        std::unreachable();
+    }
+
+    struct Symbol {
+        bool isTerminal;
+        size_t value;
+    };
+
+    struct Production {
+        size_t rule;
+        std::vector<Symbol> symbols;
+        std::string text;
+    };
+
+    struct Grammar {
+        std::vector<std::string> rules;
+        std::vector<Production> productions;
+    };
+
+    /**
+     * Lee las producciones de Gramática, una por línea con la forma
+     * «A -> X Y Z» o «A -> lambda». Los no terminales son los símbolos
+     * que aparecen a la izquierda de alguna producción.
+     * @return La gramática, o nada si el fichero tiene errores.
+     */
+    std::optional<Grammar> ReadGrammar(std::istream& input) {
+        std::vector<std::pair<std::string, std::vector<std::string>>> lines;
+        std::string line;
+
+        while (std::getline(input, line)) {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            std::istringstream words(line);
+            std::string lhs, arrow, word;
+            if (!(words >> lhs))
+                continue;
+
+            if (!(words >> arrow) || arrow != "->") {
+                std::cerr << "Falta «->» en la producción «" << line << "».\n";
+                return std::nullopt;
+            }
+
+            std::vector<std::string> rhs;
+            while (words >> word)
+                rhs.push_back(word);
+
+            if (rhs.empty()) {
+                std::cerr << "La producción «" << line << "» no tiene parte derecha.\n";
+                return std::nullopt;
+            }
+
+            lines.emplace_back(lhs, rhs);
+        }
+
+        Grammar grammar;
+        std::map<std::string, size_t> ruleIndices;
+
+        for (const auto& [lhs, rhs] : lines) {
+            if (ruleIndices.try_emplace(lhs, grammar.rules.size()).second)
+                grammar.rules.push_back(lhs);
+        }
+
+        for (const auto& [lhs, rhs] : lines) {
+            Production production { .rule = ruleIndices.at(lhs), .symbols = {}, .text = lhs + " ->" };
+
+            for (const std::string& word : rhs) {
+                production.text += " " + word;
+
+                if (word == "lambda") {
+                    if (rhs.size() != 1) {
+                        std::cerr << "«lambda» debe ir sola en la producción «" << production.text << "».\n";
+                        return std::nullopt;
+                    }
+                } else if (const auto it = ruleIndices.find(word); it != ruleIndices.end()) {
+                    production.symbols.push_back({ .isTerminal = false, .value = it->second });
+                } else if (const Terminal* terminal = FindTerminal(word)) {
+                    production.symbols.push_back({
+                        .isTerminal = true,
+                        .value = std::to_underlying(terminal->type)
+                    });
+                } else {
+                    std::cerr << "El símbolo «" << word << "» no es un terminal ni un no terminal.\n";
+                    return std::nullopt;
+                }
+            }
+
+            grammar.productions.push_back(std::move(production));
+        }
+
+        if (grammar.productions.empty()) {
+            std::cerr << "La gramática está vacía.\n";
+            return std::nullopt;
+        }
+
+        return grammar;
+    }
+
+    /** Los conjuntos First y Follow de los no terminales. **/
+    struct Sets {
+        std::vector<TokenSet> first;
+        std::vector<bool> nullable;
+        std::vector<TokenSet> follow;
+    };
+
+    constexpr TokenSet TokenBit(const size_t type) {
+        return TokenSet { 1 } << type;
+    }
+
+    /**
+     * El conjunto First de una secuencia de símbolos.
+     * @return El conjunto y si la secuencia deriva la cadena vacía.
+     */
+    std::pair<TokenSet, bool> GetSequenceFirst(
+        const Sets& sets,
+        const std::vector<Symbol>& symbols,
+        const size_t start = 0
+    ) {
+        TokenSet first = 0;
+
+        for (size_t i = start; i < symbols.size(); i++) {
+            const Symbol& symbol = symbols[i];
+            if (symbol.isTerminal)
+                return { first | TokenBit(symbol.value), false };
+
+            first |= sets.first[symbol.value];
+            if (!sets.nullable[symbol.value])
+                return { first, false };
+        }
+
+        return { first, true };
+    }
+
+    /** Calcula First y Follow por punto fijo. **/
+    Sets ComputeSets(const Grammar& grammar) {
+        const size_t ruleCount = grammar.rules.size();
+
+        Sets sets {
+            .first = std::vector<TokenSet>(ruleCount),
+            .nullable = std::vector<bool>(ruleCount),
+            .follow = std::vector<TokenSet>(ruleCount)
+        };
+
+        for (bool changed = true; changed;) {
+            changed = false;
+
+            for (const Production& production : grammar.productions) {
+                const auto [first, nullable] = GetSequenceFirst(sets, production.symbols);
+
+                const TokenSet oldFirst = sets.first[production.rule];
+                sets.first[production.rule] |= first;
+                changed |= sets.first[production.rule] != oldFirst;
+
+                if (nullable && !sets.nullable[production.rule]) {
+                    sets.nullable[production.rule] = true;
+                    changed = true;
+                }
+            }
+        }
+
+        // El axioma es el no terminal de la primera producción.
+        sets.follow[grammar.productions.front().rule] = TokenBit(std::to_underlying(TokenType::END));
+
+        for (bool changed = true; changed;) {
+            changed = false;
+
+            for (const Production& production : grammar.productions) {
+                for (size_t i = 0; i < production.symbols.size(); i++) {
+                    const Symbol& symbol = production.symbols[i];
+                    if (symbol.isTerminal)
+                        continue;
+
+                    auto [follow, nullable] = GetSequenceFirst(sets, production.symbols, i + 1);
+                    if (nullable)
+                        follow |= sets.follow[production.rule];
+
+                    const TokenSet oldFollow = sets.follow[symbol.value];
+                    sets.follow[symbol.value] |= follow;
+                    changed |= sets.follow[symbol.value] != oldFollow;
+                }
+            }
+        }
+
+        return sets;
+    }
+
+    /**
+     * Comprueba que todos los no terminales derivan alguna cadena de
+     * terminales. Una recursividad por la izquierda sin alternativa no da
+     * conflictos en la tabla, pero deja el no terminal sin cadenas.
+     */
+    bool CheckProductive(const Grammar& grammar) {
+        std::vector<bool> productive(grammar.rules.size());
+
+        for (bool changed = true; changed;) {
+            changed = false;
+
+            for (const Production& production : grammar.productions) {
+                if (productive[production.rule])
+                    continue;
+
+                const bool isProductive = std::ranges::all_of(production.symbols, [&](const Symbol& symbol) {
+                    return symbol.isTerminal || productive[symbol.value];
+                });
+
+                if (isProductive) {
+                    productive[production.rule] = true;
+                    changed = true;
+                }
+            }
+        }
+
+        bool isValid = true;
+        for (size_t rule = 0; rule < grammar.rules.size(); rule++) {
+            if (!productive[rule]) {
+                std::cerr << "El no terminal " << grammar.rules[rule] << " no deriva ninguna cadena.\n";
+                isValid = false;
+            }
+        }
+
+        return isValid;
+    }
+
+    std::string TokenSetToString(const TokenSet set) {
+        std::string result = "{";
+        for (size_t type = 0; type < TOKEN_TYPE_COUNT; type++) {
+            if (set & TokenBit(type)) {
+                result += " ";
+                result += GetTerminal(type).text;
+            }
+        }
+        return result + " }";
+    }
+
+    std::string Hex(const TokenSet set) {
+        char buffer[11];
+        std::snprintf(buffer, sizeof(buffer), "0x%08X", set);
+        return buffer;
+    }
+
+    /**
+     * Calcula la tabla LL(1) de la gramática.
+     * @return La producción por no terminal y token, o nada si hay conflictos.
+     */
+    std::optional<std::vector<std::vector<size_t>>> BuildTable(const Grammar& grammar, const Sets& sets) {
+        std::vector table(grammar.rules.size(), std::vector<size_t>(TOKEN_TYPE_COUNT));
+        bool isValid = true;
+
+        for (size_t p = 0; p < grammar.productions.size(); p++) {
+            const Production& production = grammar.productions[p];
+            auto [tokens, nullable] = GetSequenceFirst(sets, production.symbols);
+            if (nullable)
+                tokens |= sets.follow[production.rule];
+
+            for (size_t type = 0; type < TOKEN_TYPE_COUNT; type++) {
+                if (!(tokens & TokenBit(type)))
+                    continue;
+
+                size_t& cell = table[production.rule][type];
+                if (cell != 0) {
+                    std::cerr << "Conflicto LL(1) en " << grammar.rules[production.rule]
+                              << " con «" << GetTerminal(type).text << "»: «"
+                              << grammar.productions[cell - 1].text << "» y «"
+                              << production.text << "».\n";
+                    isValid = false;
+                } else {
+                    cell = p + 1;
+                }
+            }
+        }
+
+        if (!isValid)
+            return std::nullopt;
+
+        // Como en el analizador recursivo, un no terminal anulable elige su
+        // producción anulable con cualquier token que no la descarte: el
+        // token inesperado da el error del siguiente terminal que se compruebe.
+        for (size_t p = 0; p < grammar.productions.size(); p++) {
+            const Production& production = grammar.productions[p];
+            if (!GetSequenceFirst(sets, production.symbols).second)
+                continue;
+
+            for (size_t& cell : table[production.rule]) {
+                if (cell == 0)
+                    cell = p + 1;
+            }
+        }
+
+        return table;
+    }
+
+    void WriteHeader(std::ostream& output, const Grammar& grammar, const Sets& sets, const std::vector<std::vector<size_t>>& table) {
+        size_t maxLength = 1;
+        for (const Production& production : grammar.productions)
+            maxLength = std::max(maxLength, production.symbols.size());
+
+        output << "#pragma once\n\n"
+               << "// Generado por tools/GenerateParserTables.cpp a partir de Gramática. No editar a mano.\n\n"
+               << "#include \"language/core/Token.h\"\n\n"
+               << "#include <array>\n"
+               << "#include <cstdint>\n"
+               << "#include <utility>\n\n"
+               << "/** Los no terminales de la gramática, en el orden en el que aparecen en Gramática. **/\n"
+               << "enum class NonTerminal : uint8_t {\n";
+        for (const std::string& rule : grammar.rules)
+            output << "    " << rule << ",\n";
+        output << "\n    COUNT\n};\n\n";
+
+        output << "/**\n"
+               << " * La gramática del analizador sintáctico y su tabla LL(1). Las producciones\n"
+               << " * se numeran desde 1 en el orden de Gramática, como en la traza del análisis.\n"
+               << " */\n"
+               << "namespace ParserTable {\n"
+               << "    constexpr size_t PRODUCTION_COUNT = " << grammar.productions.size() << ";\n"
+               << "    constexpr size_t RULE_COUNT = std::to_underlying(NonTerminal::COUNT);\n"
+               << "    constexpr size_t TOKEN_TYPE_COUNT = " << TOKEN_TYPE_COUNT << ";\n"
+               << "    constexpr size_t MAX_PRODUCTION_LENGTH = " << maxLength << ";\n\n"
+               << "    // Los conjuntos dependen del valor de cada tipo de token.\n"
+               << "    static_assert(std::to_underlying(TokenType::CSTR) + 1 == TOKEN_TYPE_COUNT";
+        for (size_t type = 0; type < TOKEN_TYPE_COUNT; type++)
+            output << "\n        && std::to_underlying(TokenType::" << GetTerminal(type).name << ") == " << type;
+        output << ");\n\n";
+
+        output << "    /** Un conjunto de tipos de token, con un bit por tipo. **/\n"
+               << "    using TokenSet = uint32_t;\n\n"
+               << "    /** Un símbolo de la parte derecha de una producción. **/\n"
+               << "    struct GrammarSymbol {\n"
+               << "        bool isTerminal;\n"
+               << "        uint8_t value;\n"
+               << "    };\n\n"
+               << "    constexpr GrammarSymbol TerminalSymbol(const TokenType type) {\n"
+               << "        return { .isTerminal = true, .value = std::to_underlying(type) };\n"
+               << "    }\n\n"
+               << "    constexpr GrammarSymbol RuleSymbol(const NonTerminal rule) {\n"
+               << "        return { .isTerminal = false, .value = std::to_underlying(rule) };\n"
+               << "    }\n\n"
+               << "    struct Production {\n"
+               << "        NonTerminal rule;\n"
+               << "        uint8_t length;\n"
+               << "        std::array<GrammarSymbol, MAX_PRODUCTION_LENGTH> symbols;\n\n"
+               << "        /** El conjunto First de la parte derecha. **/\n"
+               << "        TokenSet first;\n\n"
+               << "        /** Si la parte derecha deriva la cadena vacía. **/\n"
+               << "        bool nullable;\n"
+               << "    };\n\n";
+
+        output << "    /** Las producciones, la primera en la posición 0. **/\n"
+               << "    constexpr std::array<Production, PRODUCTION_COUNT> PRODUCTIONS {{\n";
+        for (size_t p = 0; p < grammar.productions.size(); p++) {
+            const Production& production = grammar.productions[p];
+            const auto [first, nullable] = GetSequenceFirst(sets, production.symbols);
+
+            output << "        // " << p + 1 << ". " << production.text << "\n"
+                   << "        { NonTerminal::" << grammar.rules[production.rule] << ", "
+                   << production.symbols.size() << ", {{";
+            for (size_t i = 0; i < production.symbols.size(); i++) {
+                const Symbol& symbol = production.symbols[i];
+                output << (i == 0 ? " " : ", ");
+                if (symbol.isTerminal)
+                    output << "TerminalSymbol(TokenType::" << GetTerminal(symbol.value).name << ")";
+                else
+                    output << "RuleSymbol(NonTerminal::" << grammar.rules[symbol.value] << ")";
+            }
+            output << (production.symbols.empty() ? "" : " ") << "}}, "
+                   << Hex(first) << ", " << (nullable ? "true" : "false") << " },\n";
+        }
+        output << "    }};\n\n";
+
+        output << "    /** El conjunto First de cada no terminal, sin la cadena vacía. **/\n"
+               << "    constexpr std::array<TokenSet, RULE_COUNT> FIRST {\n";
+        for (size_t rule = 0; rule < grammar.rules.size(); rule++) {
+            output << "        " << Hex(sets.first[rule]) << ", // " << grammar.rules[rule]
+                   << " " << TokenSetToString(sets.first[rule]) << "\n";
+        }
+        output << "    };\n\n";
+
+        output << "    /** Si cada no terminal deriva la cadena vacía. **/\n"
+               << "    constexpr std::array<bool, RULE_COUNT> NULLABLE {\n";
+        for (size_t rule = 0; rule < grammar.rules.size(); rule++) {
+            output << "        " << (sets.nullable[rule] ? "true" : "false") << ", // "
+                   << grammar.rules[rule] << "\n";
+        }
+        output << "    };\n\n";
+
+        output << "    /** El conjunto Follow de cada no terminal. **/\n"
+               << "    constexpr std::array<TokenSet, RULE_COUNT> FOLLOW {\n";
+        for (size_t rule = 0; rule < grammar.rules.size(); rule++) {
+            output << "        " << Hex(sets.follow[rule]) << ", // " << grammar.rules[rule]
+                   << " " << TokenSetToString(sets.follow[rule]) << "\n";
+        }
+        output << "    };\n\n";
+
+        output << "    using Row = std::array<uint8_t, TOKEN_TYPE_COUNT>;\n\n"
+               << "    /**\n"
+               << "     * La producción a elegir por no terminal y tipo de token, o cero si es\n"
+               << "     * un error. Un no terminal anulable elige su producción anulable con\n"
+               << "     * cualquier token que no sea de otra, igual que el analizador recursivo.\n"
+               << "     */\n"
+               << "    constexpr std::array<Row, RULE_COUNT> PREDICTION_TABLE {{\n";
+        for (size_t rule = 0; rule < grammar.rules.size(); rule++) {
+            output << "        {{";
+            for (size_t type = 0; type < TOKEN_TYPE_COUNT; type++)
+                output << (type == 0 ? " " : ", ") << table[rule][type];
+            output << " }}, // " << grammar.rules[rule] << "\n";
+        }
+        output << "    }};\n"
+               << "}\n";
+    }
+}
+
+int main(const int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Uso: " << argv[0] << " <Gramática> <ParserGrammar.h>\n";
+        return 1;
+    }
+
+    std::ifstream input(argv[1], std::ios::binary);
+    if (!input) {
+        std::cerr << "No se ha podido abrir " << argv[1] << "\n";
+        return 1;
+    }
+
+    const auto grammar = ReadGrammar(input);
+    if (!grammar.has_value())
+        return 1;
+
+    if (grammar->productions.size() > UINT8_MAX || grammar->rules.size() > UINT8_MAX) {
+        std::cerr << "La gramática tiene demasiadas producciones para la tabla.\n";
+        return 1;
+    }
+
+    if (!CheckProductive(*grammar))
+        return 1;
+
+    const Sets sets = ComputeSets(*grammar);
+
+    const auto table = BuildTable(*grammar, sets);
+    if (!table.has_value()) {
+        std::cerr << "La gramática no es LL(1).\n";
+        return 1;
+    }
+
+    // Se escribe entero en memoria para no dejar una tabla a medias si falla.
+    std::ostringstream header;
+    WriteHeader(header, *grammar, sets, *table);
+
+    std::ofstream output(argv[2], std::ios::binary);
+    if (!output) {
+        std::cerr << "No se ha podido abrir " << argv[2] << "\n";
+        return 1;
+    }
+
+    output << header.str();
+
+    return output ? 0 : 1;
+}
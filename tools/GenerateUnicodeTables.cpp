@@ -0,0 +1,129 @@
+// Genera src/language/core/UnicodeTables.h con las propiedades Unicode que
+// usa el analizador, tal y como las define ICU. Se compila y ejecuta con el
+// objetivo «UnicodeTables» de CMake, sólo al actualizar la versión de Unicode.
+
+#include <unicode/uchar.h>
+#include <unicode/uversion.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr UChar32 CODEPOINT_COUNT = 0x110000;
+
+    /** Los puntos de código de cada bloque de la tabla de segundo nivel. **/
+    constexpr UChar32 BLOCK_SIZE = 256;
+    constexpr UChar32 BLOCK_COUNT = CODEPOINT_COUNT / BLOCK_SIZE;
+
+    /** Un bloque como mapa de bits: un bit por punto de código. **/
+    using Block = std::array<uint64_t, BLOCK_SIZE / 64>;
+
+    struct Property {
+        const char* name;
+        UBool (*test)(UChar32);
+    };
+
+    std::string Hex(const uint64_t value) {
+        char buffer[19];
+        std::snprintf(buffer, sizeof(buffer), "0x%016llX", static_cast<unsigned long long>(value));
+        return buffer;
+    }
+
+    /**
+     * Escribe las dos tablas de una propiedad: el índice del bloque de cada
+     * tramo de 256 puntos de código y los bloques distintos, sin repetir.
+     */
+    void WriteProperty(std::ostream& output, const Property& property) {
+        std::vector<Block> blocks;
+        std::map<Block, size_t> blockIndices;
+        std::vector<size_t> index;
+
+        for (UChar32 b = 0; b < BLOCK_COUNT; b++) {
+            Block block {};
+            for (UChar32 i = 0; i < BLOCK_SIZE; i++) {
+                if (property.test(b * BLOCK_SIZE + i))
+                    block[i / 64] |= uint64_t { 1 } << (i % 64);
+            }
+
+            const auto [it, inserted] = blockIndices.try_emplace(block, blocks.size());
+            if (inserted)
+                blocks.push_back(block);
+
+            index.push_back(it->second);
+        }
+
+        const char* indexType = blocks.size() <= 256 ? "uint8_t" : "uint16_t";
+
+        output << "    inline constexpr std::array<" << indexType << ", " << BLOCK_COUNT << "> "
+               << property.name << "_INDEX {\n";
+        for (size_t i = 0; i < index.size(); i++) {
+            output << (i % 16 == 0 ? "        " : " ") << index[i] << ",";
+            if (i % 16 == 15 || i + 1 == index.size())
+                output << "\n";
+        }
+        output << "    };\n\n";
+
+        output << "    inline constexpr std::array<UnicodeBlock, " << blocks.size() << "> "
+               << property.name << "_BLOCKS {{\n";
+        for (const Block& block : blocks) {
+            output << "        {{ ";
+            for (size_t i = 0; i < block.size(); i++)
+                output << Hex(block[i]) << (i + 1 == block.size() ? " " : ", ");
+            output << "}},\n";
+        }
+        output << "    }};\n";
+    }
+}
+
+int main(const int argc, char* argv[]) {
+    if (argc != 2) {
+        std::cerr << "Uso: " << argv[0] << " <UnicodeTables.h>\n";
+        return 1;
+    }
+
+    std::ofstream output(argv[1], std::ios::binary);
+    if (!output) {
+        std::cerr << "No se ha podido abrir " << argv[1] << "\n";
+        return 1;
+    }
+
+    UVersionInfo version;
+    u_getUnicodeVersion(version);
+    char versionString[U_MAX_VERSION_STRING_LENGTH];
+    u_versionToString(version, versionString);
+
+    const std::array<Property, 3> properties {{
+        { "ALPHA", u_isalpha },
+        { "ALNUM", u_isalnum },
+        { "PRINT", u_isprint },
+    }};
+
+    output << "#pragma once\n\n"
+           << "// Generado por tools/GenerateUnicodeTables.cpp con ICU " << U_ICU_VERSION
+           << " (Unicode " << versionString << "). No editar a mano.\n\n"
+           << "#include <array>\n"
+           << "#include <cstdint>\n\n"
+           << "/**\n"
+           << " * Tablas de dos niveles de las propiedades Unicode de los caracteres. El\n"
+           << " * índice de cada propiedad da, para cada tramo de " << BLOCK_SIZE << " puntos de código,\n"
+           << " * su bloque: un mapa de bits con un bit por punto de código.\n"
+           << " */\n"
+           << "namespace UnicodeTables {\n"
+           << "    constexpr char32_t BLOCK_SIZE = " << BLOCK_SIZE << ";\n\n"
+           << "    using UnicodeBlock = std::array<uint64_t, " << BLOCK_SIZE / 64 << ">;\n";
+
+    for (const Property& property : properties) {
+        output << "\n";
+        WriteProperty(output, property);
+    }
+
+    output << "}\n";
+
+    return output ? 0 : 1;
+}